@@ -97,6 +97,6 @@ public:
    void resetAllAutoNumbers();
 };
 
-extern autoNumberFP gAutoNumberFP;
+extern autoNumberFP* gAutoNumberFP;
 
 #endif
@@ -60,33 +60,42 @@ public:
   // returns a boolean  
   unsigned int	parse(istream &);
 
+  // parse a section that is already in memory. The section is
+  // scanned in place; it need not be NULL terminated.
+  unsigned int	parse(const char *section, unsigned int length);
+
   // parse without calling Begin() and End() on the renderer.
   unsigned int	rawParse(istream &);
+  unsigned int	rawParse(const char *section, unsigned int length);
 
 protected:
-  virtual void read_data(istream &, ostringstream &);
+  // scan the data up to the next tag into f_text, replacing entities
+  virtual void read_data();
+
+  // make room for at least length more bytes in f_text
+  void		reserve_text(unsigned int length);
 
 private:
   
-  void		process(istream &, ostringstream &, const Symbol &tagname,
+  void		process(const Symbol &tagname,
 			unsigned int sibling_number,
 			unsigned int relative_sibling_number);
-  TagType	read_tag(istream &, ostringstream &);
-  void		process_entity(istream &, ostringstream &);
+  TagType	read_tag();
+  void		skip_newlines();
 
-  void		process_attributes(istream &, ostringstream &,
-				   AttributeList *&attrs,
+  void		process_attributes(AttributeList *&attrs,
 				   AttributeList *&olias_attrs);
-  Attribute    *process_attribute(istream &, ostringstream &, const Symbol &name, TagType);
+  Attribute    *process_attribute(const Symbol &name, TagType);
   
+protected:
+  const char   *f_cursor;	// next byte of the section to scan
+  const char   *f_end;		// end of the section
+
+  char	       *f_text;		// the last tag name or data scanned,
+  unsigned int	f_text_length;	// NULL terminated
+  unsigned int	f_text_size;
+
 private:
   unsigned int	f_ignoring_element ;
   Resolver      &f_resolver;
-#if defined(SC3)
-  char* const	f_buffer;
-  ostrstream	f_output;
-#else
-  stringbuf	*f_streambuf;
-  ostringstream	f_output;
-#endif
 };
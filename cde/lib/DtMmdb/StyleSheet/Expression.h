@@ -62,6 +62,10 @@ public:
   virtual FeatureValue *evaluate() const;
   ostream &print(ostream &) const; 
 
+  // true if evaluate() depends on the style sheet alone, and not on
+  // the element, its parents or the autonumbers
+  unsigned int constant() const;
+
 private:
   TermNode* f_root;
 };
@@ -73,6 +77,7 @@ public:
   virtual FeatureValue *evaluate() const = 0;
   virtual ostream &print(ostream &) const = 0;
   virtual TermNode *clone() const = 0;
+  virtual unsigned int constant() const;
 };
 
 class VariableNode: public TermNode
@@ -85,6 +90,7 @@ public:
   ostream &print(ostream &) const;
 
   virtual TermNode *clone() const;
+  virtual unsigned int constant() const;
 
 private:
   Symbol f_name;
@@ -125,6 +131,7 @@ public:
   ~BinaryOperatorNode();
 
   virtual TermNode *clone() const;
+  virtual unsigned int constant() const;
 
   virtual FeatureValue *evaluate() const;
   ostream &print(ostream &) const;
@@ -162,6 +169,7 @@ public:
   ostream &print(ostream &) const;
 
   virtual TermNode *clone() const;
+  virtual unsigned int constant() const;
 
 private:
   FeatureValue *f_value;
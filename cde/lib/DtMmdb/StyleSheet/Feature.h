@@ -35,6 +35,7 @@
 #endif
 
 #include "SymTab.h"
+#include "StyleArena.h"
 
 class Element;
 class Expression;
@@ -66,12 +67,20 @@ public:
   Feature(const Feature &);
   ~Feature();
 
+  STYLE_ARENA_SIGNATURES
+
 
   const Symbol       &name()	const	{ return f_name ; }
   const FeatureValue *value()	const	{ return f_value ; }	
 
   FeatureValue *evaluate() const;
 
+  // replaces a value that depends on the style sheet alone by its
+  // evaluated form, so evaluate() can just copy it. See
+  // FeatureSet::compile()
+  void compile();
+  unsigned int folded() const { return f_folded ; }
+
   // destructively modifies f_value 
   void merge(const Feature &);
 
@@ -85,6 +94,7 @@ private:
 private:
   Symbol	f_name ;
   FeatureValue *f_value;
+  unsigned int	f_folded;
 
 };
 
@@ -109,6 +119,8 @@ public:
 	     const FeatureSet &); /* merge */
   virtual ~FeatureSet();
 
+  STYLE_ARENA_SIGNATURES
+
   void			add(Feature *);
   const Feature	       *lookup(const Symbol *) const ;
   const Feature	       *lookup(const Symbol &) const;
@@ -135,6 +147,11 @@ public:
   // evaluate self and place answers into result_set, returns result set
   FeatureSet *evaluate(FeatureSet *result_set) const ;
 
+  // evaluate the constant parts of a raw (style sheet) feature set
+  // once, ahead of the elements. Called when the PathTable is set up.
+  void compile();
+  unsigned int constant() const;
+
   unsigned int operator == (const FeatureSet &) const ;
 
   ostream &print(ostream &) const ;
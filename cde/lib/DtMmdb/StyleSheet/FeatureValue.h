@@ -33,6 +33,7 @@
 #endif
 
 #include <string.h>
+#include "StyleArena.h"
 
 #if 0
 //  SWM -- COMMENT THIS OUT -- MMDB utility/funcs.h defines this
@@ -69,12 +70,17 @@ public:
   FeatureValue	(FeatureType type) : f_type(type) {}
   virtual ~FeatureValue();
 
+  STYLE_ARENA_SIGNATURES
+
   const FeatureType	type()	const { return f_type ; }
   
   virtual FeatureValue *clone() const = 0; /* deep copy */
 
   virtual FeatureValue *evaluate() const;
 
+  // true if evaluate() depends on the style sheet alone
+  virtual unsigned int constant() const;
+
   virtual unsigned int operator==(const FeatureValue &) const;
   virtual unsigned int operator==(const FeatureValueInt &) const;
   virtual unsigned int operator==(const FeatureValueString &) const;
@@ -430,6 +436,7 @@ public:
   virtual FeatureValue *clone() const ; /* deep copy */
 
   virtual FeatureValue *evaluate() const;
+  virtual unsigned int constant() const;
 
   // operators 
 
@@ -509,6 +516,7 @@ public:
   const FeatureSet     *value()	const { return f_value ; }
 
   virtual FeatureValue *evaluate() const; 
+  virtual unsigned int constant() const;
 
   virtual FeatureValue *clone() const; /* deep copy */
 
@@ -536,6 +544,7 @@ public:
   ~FeatureValueArray();
 
   virtual FeatureValue *evaluate() const;
+  virtual unsigned int constant() const;
 
   virtual FeatureValue *clone() const 
      { return new FeatureValueArray(*this); }; /* deep copy */
@@ -569,6 +578,7 @@ public:
   virtual FeatureValue *clone() const; /* deep copy */
 
   virtual FeatureValue *evaluate() const ;
+  virtual unsigned int constant() const;
 
   // operators 
   virtual FeatureValue *operator+(const FeatureValue&) const ;
@@ -50,16 +50,29 @@ class EncodedPath
    int f_size;
    int f_patternSize;
    LetterType* f_array;
+   unsigned int f_ownArray;
 
-   hashTable<LetterType, BitVector> f_SVectors;
+// the S vector of each distinct letter in a pattern. Patterns have
+// only a few letters, so these are kept side by side and scanned.
+   int f_letters;
+   LetterType* f_letter;
+   BitVector** f_SVector;
 
    LetterType f_wildCard;
    LetterType f_unlimitedWildCard;
 
    BitVector* f_copyOfS; // copy of S vector, used in match()
+   BitVector* f_R;       // result and '*' vectors, used in match()
+   BitVector* f_I;
+
+   BitVector* SVector(LetterType);
 
 public:
    EncodedPath(SSPath* p, unsigned int asPattern = false);
+
+// a text path already encoded as its symbol ids. The array is used
+// in place and must outlive this object.
+   EncodedPath(LetterType* letters, int size);
    ~EncodedPath();
 
    int length() { return f_size; };
@@ -109,7 +122,8 @@ public:
 
    unsigned int operator==(const PathFeature&) const;
 
-   unsigned int match(SSPath& p);
+// p is the element path, text its encoding
+   unsigned int match(EncodedPath& text, SSPath& p);
 };
 
 class PathFeatureList : public CC_TPtrDlist<PathFeature> 
@@ -133,6 +147,26 @@ typedef CC_TPtrDlistIterator<PathFeature> PathFeatureListIterator;
 
 typedef CC_TPtrDlist<PathFeature>* CC_TPtrDlist_PathFeature_Ptr_T;
 
+// memoized result of getFeatureSet() for one element path, keyed by
+// the symbol ids of the path terms
+class PathCacheEntry
+{
+public:
+   PathCacheEntry(LetterType* key, int len, unsigned int hash,
+                  FeatureSet* fs, PathCacheEntry* next) :
+      f_key(key), f_len(len), f_hash(hash), f_featureSet(fs), f_next(next) {};
+   ~PathCacheEntry() { delete [] f_key; };
+
+   LetterType* f_key;
+   int f_len;
+   unsigned int f_hash;
+   FeatureSet* f_featureSet;
+   PathCacheEntry* f_next;
+};
+
+#define PATH_CACHE_BUCKETS 256
+#define PATH_CACHE_MAX_ENTRIES 8192
+
 class PathTable
 {
 public:
@@ -157,6 +191,16 @@ public:
 // deleting the object
   FeatureSet* getFeatureSet(SSPath&);
 
+// drop all memoized path resolutions. Called whenever the rule set
+// changes.
+  void clearCache();
+
+// lookups answered from the cache, matched and cached, and matched
+// without caching, since the table was created
+  unsigned int cacheHits() { return f_cacheHits; };
+  unsigned int cacheMisses() { return f_cacheMisses; };
+  unsigned int cacheUncachable() { return f_cacheUncachable; };
+
   friend ostream& operator<<(ostream&, PathTable&);
 
 private:
@@ -164,10 +208,24 @@ private:
   CC_TPtrDlist_PathFeature_Ptr_T *f_lastSymIndex;
   unsigned int		    f_lastSymIndexCount ;
 
+// f_selectorIndex[i] is true if some rule in bucket i carries an
+// attribute qualifier. Paths ending in such buckets are never cached
+// since the match then depends on attribute values, not just names.
+  unsigned char*	    f_selectorIndex;
+
+  PathCacheEntry**	    f_cache;
+  unsigned int		    f_cacheEntries;
+  unsigned int		    f_cacheHits;
+  unsigned int		    f_cacheMisses;
+  unsigned int		    f_cacheUncachable;
+
 private:
   void initLastSymIndex();
   unsigned int findIndex(SSPath&);
-  FeatureSet* getFeatureSet(int bucketIndex, SSPath&, int& pathId);
+  unsigned int cachable(SSPath&);
+  FeatureSet* matchFeatureSet(SSPath&, EncodedPath&);
+  FeatureSet* getFeatureSet(int bucketIndex, SSPath&, EncodedPath&,
+                            int& pathId);
 };
 
 extern PathTable* gPathTab;
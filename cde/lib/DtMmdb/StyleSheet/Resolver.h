@@ -69,6 +69,20 @@ public:
   // called after all data 
   virtual void End();
 
+  // time resolution for the caller to read. On from the start when
+  // MMDB_STYLE_STATS is set.
+  void timing(unsigned int on)		{ f_timing = on; }
+  unsigned int timing() const		{ return f_timing; }
+
+  // with timing on: elements resolved, and the time spent (in
+  // microseconds) getting their feature sets from the style sheet
+  unsigned int elements() const		{ return f_elements; }
+  double resolve_time() const		{ return f_resolveTime; }
+
+  // one line on the section resolved so far: the above, and the
+  // path cache lookups and style objects allocated for it
+  void report(ostream&, const char* section) const;
+
 private:
   SSPath		f_path ;
   PathTable	       &f_pathTable;
@@ -77,6 +91,16 @@ private:
   Renderer	       &f_Renderer;
 
   ResolverStack	        f_resolverStack;
+
+  unsigned int		f_timing;
+  unsigned int		f_elements;
+  double		f_resolveTime;
+
+  // counters at construction, for report()
+  unsigned long		f_arenaRequests;
+  unsigned long		f_arenaHeapAllocs;
+  unsigned int		f_cacheHits;
+  unsigned int		f_cacheMisses;
 };
 
 #endif /* _Resolver_h */
@@ -31,6 +31,8 @@
 #include "dti_cc/CC_Dlist.h"
 #endif
 
+#include "StyleArena.h"
+
 class Element ;
 class FeatureSet ;
 
@@ -44,6 +46,8 @@ public:
 
   ~ResolverStackElement();
 
+  STYLE_ARENA_SIGNATURES
+
   int
   operator==(const ResolverStackElement &);
 
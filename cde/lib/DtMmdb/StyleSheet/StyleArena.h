@@ -0,0 +1,76 @@
+/*
+ * CDE - Common Desktop Environment
+ *
+ * Copyright (c) 1993-2012, The Open Group. All rights reserved.
+ *
+ * These libraries and programs are free software; you can
+ * redistribute them and/or modify them under the terms of the GNU
+ * Lesser General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option)
+ * any later version.
+ *
+ * These libraries and programs are distributed in the hope that
+ * they will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with these libraries and programs; if not, write
+ * to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+ * Floor, Boston, MA 02110-1301 USA
+ */
+#ifndef _StyleArena_h
+#define _StyleArena_h
+
+#include <stddef.h>
+
+/* **************************************************************
+   StyleArena
+
+   Storage for the small objects the Resolver creates and deletes
+   for every element: features, feature sets and values. Freed
+   objects go onto a free list per size and are reused, most
+   recently freed first, by the next element; new storage is taken
+   from the heap a block at a time. Blocks are never given back:
+   the arena is shared by the whole process and stays at the most
+   storage that has been live at once, whatever the document.
+
+   Classes use it through STYLE_ARENA_SIGNATURES. Not thread safe.
+   MMDB_STYLE_NO_ARENA makes it a plain heap allocator that only
+   counts, for comparisons.
+ * ************************************************************** */
+
+class StyleArena
+{
+public:
+  static void  *alloc(size_t);
+  static void   free(void *, size_t);
+
+  // allocation requests and heap allocations (blocks, or objects
+  // when disabled or too big) made so far
+  static unsigned long requests()	{ return f_requests ; }
+  static unsigned long heapAllocs()	{ return f_heapAllocs ; }
+  static unsigned long live()		{ return f_live ; }
+
+private:
+  static void	init();
+  static void  *grow(unsigned int sizeClass);
+
+  struct FreeItem { FreeItem *next; };
+  struct Block    { Block *next; };
+
+  static int		f_enabled;	// -1 until init()
+  static FreeItem      *f_free[];
+  static Block	       *f_blocks;
+  static unsigned long	f_requests;
+  static unsigned long	f_heapAllocs;
+  static unsigned long	f_live;
+};
+
+#define STYLE_ARENA_SIGNATURES \
+  void *operator new(size_t sz) { return StyleArena::alloc(sz); } \
+  void operator delete(void *p, size_t sz) { StyleArena::free(p, sz); }
+
+#endif /* _StyleArena_h */
+/* DO NOT ADD ANY LINES AFTER THIS #endif */
@@ -29,6 +29,7 @@
 #include "VariableTable.h"
 #include "PathTable.h"
 #include "ResolverStack.h"
+#include "HardCopy/autoNumberFP.h"
 
 class StyleSheet 
 {
@@ -40,6 +41,7 @@ private:
    SymbolTable  	f_ElemSymTab;
    unsigned int		f_GI_CASE_SENSITIVE;
    ResolverStackElement f_TopOfStack;
+   autoNumberFP		f_autoNumberFP;
 
    char* f_name;
 
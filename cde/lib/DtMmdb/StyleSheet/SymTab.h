@@ -76,6 +76,8 @@ public:
  SymbolTable has access to internal operations
  * ************************************************************** */
 
+#define INTERN_CACHE_SIZE 256
+
 class SymbolTable : private hashTable<SymbolName, unsigned int>
 {
 public:
@@ -102,6 +104,12 @@ private:
 
   unsigned int f_IDsAssigned;
 
+  // names interned lately, by a hash of their text, so that looking
+  // up a known name (every element of a document) does not first
+  // copy it into a SymbolName
+  const SymbolName *f_internCache[INTERN_CACHE_SIZE];
+  unsigned int      f_internCacheId[INTERN_CACHE_SIZE];
+
 };
 
 
@@ -20,7 +20,7 @@
 #include <utility/funcs.h>
 
 #include "HardCopy/autoNumberFP.h"
-extern autoNumberFP gAutoNumberFP;
+extern autoNumberFP* gAutoNumberFP;
 
 extern void yyerror(char*);
 extern int yylex();
@@ -238,7 +238,7 @@ var_assignment	: STRING OPER_assign rhs.gp
 	{
            Expression *x = new Expression(new ConstantNode($3));
 
-           if ( gAutoNumberFP.accept((const char*)$1, x) ) {
+           if ( gAutoNumberFP -> accept((const char*)$1, x) ) {
 	         delete $1;
 	         delete x;
                  break;
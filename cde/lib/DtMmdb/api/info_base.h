@@ -59,6 +59,8 @@
 #include "object/cset.h"
 #include "object/dl_list.h"
 
+class info_lib;
+
 class Iterator
 {
 public:
@@ -88,10 +90,20 @@ public:
               const char* base_dir, const char* base_name,
               const char* base_desc, const char* base_uid, 
 	      const char* base_locale,
-	      const mm_version& v
+	      const mm_version& v, Boolean opened = true,
+              info_lib* lib = 0
             );
    virtual ~info_base();
 
+// bring the schema and stores of a base constructed with
+// opened == false into memory. Done on the first get_set()
+// or get_list(); callers going to the object dict directly
+// must call it themselves. A base that fails to open is
+// recorded in lib's bad base list, and its get_set() and
+// get_list() throw from then on.
+   void open();
+   Boolean is_open() { return f_open; };
+
 // export funcs
    cset_handlerPtr get_set( const char* set_name );
    cset_handlerPtr get_set( int set_position );
@@ -132,6 +144,12 @@ protected:
 
    mm_version f_v;
 
+   Boolean f_open;
+   int f_mode_8_3;
+   info_lib* f_lib;
+
+   void _init_handlers();
+
    int get_set_pos( const char* set_name );
    int get_list_pos( const char* list_name );
 
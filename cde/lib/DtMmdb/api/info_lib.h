@@ -67,7 +67,8 @@ class info_lib : public primitive
 public:
    info_lib(char** set_name_array, char** list_name_array,
             char* info_lib_dir = 0, char* selected_base_name = 0, 
-            char* info_lib_name = (char*)"", int descriptor = -1);
+            char* info_lib_name = (char*)"", int descriptor = -1,
+            Boolean lazy_bases = false);
 
    virtual ~info_lib();
 
@@ -98,6 +99,9 @@ public:
    void next(long& ind) { info_base_list.next(ind); };
 
 
+// find the base holding a locator or graphic. Bases already open
+// are searched first; the rest are then opened in turn until one
+// holds it, as a base's locators can't be looked up otherwise.
    enum TestSelector { LOC, GRA };
    info_base* getInfobaseByComponent( const char *locator_string, 
 			   enum TestSelector sel);
@@ -126,7 +130,8 @@ protected:
                               const char* base_desc,
                               const char* base_uid,
                               const char* base_locale,
-                              const mm_version& v
+                              const mm_version& v,
+                              Boolean lazy = false
                              );
 
 
@@ -137,6 +142,11 @@ protected:
 
    int f_descriptor;
 
+   void _add_bad_info_base(const char* lib_path, const char* base_name);
+
+// a lazily opened base records itself as bad if open() fails
+   friend class info_base;
+
 /*
    void define_composites(composite_mgr_t* mgr_ptr,
                           char* new_db_path,
@@ -82,6 +82,9 @@ public:
    virtual ~smart_ptr() {};
 
    int get_int(int component_index);
+
+// the string returned without a buffer lives in a buffer shared by
+// all readers; pass one in multi-reader mode
    const char* get_string(int component_index);
    const char* get_string(int component_index, buffer&);
    int get_string_size(int component_index);
@@ -87,6 +87,14 @@ public:
    Boolean remove(data_t& w);
    Boolean member(data_t& w);
 
+// build an empty tree bottom-up from n keys sorted by compare(), with
+// no duplicates. Returns false if the tree already holds keys.
+   Boolean load(data_t** keys, int n);
+   Boolean empty();
+
+// key order of the underlying tree
+   static int compare(data_t&, data_t&);
+
    ostream& asciiOut(ostream& out);
    istream& asciiIn(istream& in);
 
@@ -97,6 +105,7 @@ protected:
 
 protected:
    void data_t_2_DBT(data_t& w);
+   static void data_t_2_DBT(data_t& w, DBT& key);
 };
 
 #endif
@@ -0,0 +1,373 @@
+/*
+ * CDE - Common Desktop Environment
+ *
+ * Copyright (c) 1993-2012, The Open Group. All rights reserved.
+ *
+ * These libraries and programs are free software; you can
+ * redistribute them and/or modify them under the terms of the GNU
+ * Lesser General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option)
+ * any later version.
+ *
+ * These libraries and programs are distributed in the hope that
+ * they will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with these libraries and programs; if not, write
+ * to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+ * Floor, Boston, MA 02110-1301 USA
+ */
+/*
+ * Bottom-up bulk loading of an empty btree.
+ */
+
+#include <sys/types.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <db.h>
+#include "btree.h"
+
+#define	MAXLEVELS	32		/* tree height limit */
+
+typedef struct _blevel {
+	PAGE	*page;			/* page being filled (pinned) */
+	pgno_t	 first;			/* leftmost page of the level */
+} BLEVEL;
+
+static PAGE	*bl_newpage __P((BTREE *, PAGE *, u_long));
+static int	 bl_internal __P((BTREE *, BLEVEL *, int,
+		    const char *, size_t, u_char, pgno_t));
+static int	 bl_preserve __P((BTREE *, const char *));
+
+/*
+ * __BT_LOAD -- Build a btree from a sorted stream of key/data pairs.
+ *
+ * The tree must be empty.  Leaf pages are filled completely, left to
+ * right, and each new page's first key is pushed into the internal
+ * level above it, which is filled the same way.  No page is ever split
+ * and every page but the last one of each level is full.  When the
+ * stream ends, the single page on the top level is moved to P_ROOT.
+ *
+ * Parameters:
+ *	dbp:	pointer to access method
+ *	next:	returns 1 and the next pair, 0 at the end, -1 on error
+ *	arg:	argument to next
+ *
+ * Returns:
+ *	RET_ERROR, RET_SUCCESS and RET_SPECIAL if the tree is not empty.
+ *	Keys must be strictly increasing in the order of the tree's
+ *	comparison function; otherwise errno is set to EINVAL and the tree
+ *	is left incomplete.
+ */
+int
+__bt_load(const DB *dbp, int (*next)(void *, DBT *, DBT *), void *arg)
+{
+	BTREE *t;
+	BLEVEL lv[MAXLEVELS];
+	DBT ukey, udata, last, tkey, tdata, *key, *data;
+	PAGE *h, *r, *parent;
+	pgno_t pg;
+	size_t nbytes, nksize, lastsz;
+	u_long nkeys;
+	int dflags, i, status, top;
+	char *dest, db[NOVFLSIZE], kb[NOVFLSIZE];
+
+	if (dbp->type != DB_BTREE) {
+		errno = EINVAL;
+		return (RET_ERROR);
+	}
+
+	t = dbp->internal;
+
+	/* Toss any page pinned across calls. */
+	if (t->bt_pinned != NULL) {
+		mpool_put(t->bt_mp, t->bt_pinned, 0);
+		t->bt_pinned = NULL;
+	}
+
+	if (ISSET(t, B_RDONLY)) {
+		errno = EPERM;
+		return (RET_ERROR);
+	}
+
+	if ((r = mpool_get(t->bt_mp, P_ROOT, 0)) == NULL)
+		return (RET_ERROR);
+	if (NEXTINDEX(r) != 0 || !(r->flags & P_BLEAF)) {
+		mpool_put(t->bt_mp, r, 0);
+		return (RET_SPECIAL);
+	}
+	mpool_put(t->bt_mp, r, 0);
+
+	memset(lv, 0, sizeof(lv));
+	last.data = NULL;
+	last.size = 0;
+	lastsz = 0;
+	nkeys = 0;
+	status = RET_ERROR;
+
+	while ((i = next(arg, &ukey, &udata)) == 1) {
+		if (nkeys++ > 0 && t->bt_cmp(&ukey, &last) <= 0) {
+			errno = EINVAL;
+			goto err;
+		}
+
+		/* Store big key/data items on overflow pages, as __bt_put. */
+		dflags = 0;
+		key = &ukey;
+		data = &udata;
+		if (key->size + data->size > t->bt_ovflsize) {
+			if (key->size > t->bt_ovflsize) {
+storekey:			if (__ovfl_put(t, key, &pg) == RET_ERROR)
+					goto err;
+				tkey.data = kb;
+				tkey.size = NOVFLSIZE;
+				memmove(kb, &pg, sizeof(pgno_t));
+				memmove(kb + sizeof(pgno_t),
+				    &key->size, sizeof(size_t));
+				dflags |= P_BIGKEY;
+				key = &tkey;
+			}
+			if (key->size + data->size > t->bt_ovflsize) {
+				if (__ovfl_put(t, data, &pg) == RET_ERROR)
+					goto err;
+				tdata.data = db;
+				tdata.size = NOVFLSIZE;
+				memmove(db, &pg, sizeof(pgno_t));
+				memmove(db + sizeof(pgno_t),
+				    &data->size, sizeof(size_t));
+				dflags |= P_BIGDATA;
+				data = &tdata;
+			}
+			if (key->size + data->size > t->bt_ovflsize)
+				goto storekey;
+		}
+
+		nbytes = NBLEAFDBT(key->size, data->size);
+		h = lv[0].page;
+		if (h == NULL) {
+			if ((h = bl_newpage(t, NULL, P_BLEAF)) == NULL)
+				goto err;
+			lv[0].page = h;
+			lv[0].first = h->pgno;
+		} else if (h->upper - h->lower < nbytes + sizeof(indx_t)) {
+			/*
+			 * Start a new leaf.  Its separator in the parent only
+			 * needs to tell the new key from the last one on the
+			 * page to the left, except for the next-to-leftmost
+			 * key on the leftmost internal page (see __bt_split).
+			 */
+			parent = lv[1].page;
+			nksize = 0;
+			if (t->bt_pfx && !(dflags & P_BIGKEY) &&
+			    parent != NULL && (parent->prevpg != P_INVALID ||
+			    NEXTINDEX(parent) > 1))
+				nksize = t->bt_pfx(&last, &ukey);
+
+			if ((h = bl_newpage(t, h, P_BLEAF)) == NULL)
+				goto err;
+			lv[0].page = h;
+
+			if (nksize != 0 && nksize < key->size)
+				status = bl_internal(t, lv, 1,
+				    ukey.data, nksize, 0, h->pgno);
+			else
+				status = bl_internal(t, lv, 1, key->data,
+				    key->size, dflags & P_BIGKEY, h->pgno);
+			if (status == RET_SUCCESS && dflags & P_BIGKEY)
+				status = bl_preserve(t, key->data);
+			if (status != RET_SUCCESS)
+				goto err;
+			status = RET_ERROR;
+		}
+
+		h->linp[NEXTINDEX(h)] = h->upper -= nbytes;
+		h->lower += sizeof(indx_t);
+		dest = (char *)h + h->upper;
+		WR_BLEAF(dest, key, data, dflags);
+
+		/* Remember the user's key for ordering and prefixes. */
+		if (lastsz < ukey.size) {
+			if ((dest = __fix_realloc(last.data, ukey.size)) == NULL)
+				goto err;
+			last.data = dest;
+			lastsz = ukey.size;
+		}
+		memmove(last.data, ukey.data, ukey.size);
+		last.size = ukey.size;
+	}
+	if (i != 0)
+		goto err;
+
+	if (nkeys == 0) {
+		status = RET_SUCCESS;
+		goto err;
+	}
+
+	/* Release all levels but the top one, which has a single page. */
+	for (top = MAXLEVELS - 1; lv[top].page == NULL; --top)
+		;
+	for (i = 0; i < top; ++i) {
+		mpool_put(t->bt_mp, lv[i].page, MPOOL_DIRTY);
+		lv[i].page = NULL;
+	}
+
+	/* Move the top page to the root. */
+	h = lv[top].page;
+	lv[top].page = NULL;
+	if ((r = mpool_get(t->bt_mp, P_ROOT, 0)) == NULL) {
+		mpool_put(t->bt_mp, h, MPOOL_DIRTY);
+		goto err;
+	}
+	memmove(r, h, t->bt_psize);
+	r->pgno = P_ROOT;
+	mpool_put(t->bt_mp, r, MPOOL_DIRTY);
+	if (__bt_free(t, h) == RET_ERROR)
+		goto err;
+
+	t->bt_order = NOT;
+	SET(t, B_MODIFIED | B_METADIRTY);
+	status = RET_SUCCESS;
+
+err:	for (i = 0; i < MAXLEVELS; ++i)
+		if (lv[i].page != NULL)
+			mpool_put(t->bt_mp, lv[i].page, MPOOL_DIRTY);
+	if (last.data != NULL)
+		free(last.data);
+	return (status);
+}
+
+/*
+ * BL_NEWPAGE -- Start a new page to the right of another.
+ *
+ * Parameters:
+ *	t:	tree
+ *	prev:	page to the left, or NULL; it is released
+ *	type:	page type
+ *
+ * Returns:
+ *	Pointer to the pinned page, NULL on error.
+ */
+static PAGE *
+bl_newpage(BTREE *t, PAGE *prev, u_long type)
+{
+	PAGE *h;
+	pgno_t npg;
+
+	if ((h = __bt_new(t, &npg)) == NULL)
+		return (NULL);
+
+	h->pgno = npg;
+	h->nextpg = P_INVALID;
+	h->flags = type;
+	h->lower = BTDATAOFF;
+	h->upper = t->bt_psize;
+
+	if (prev != NULL) {
+		h->prevpg = prev->pgno;
+		prev->nextpg = npg;
+		mpool_put(t->bt_mp, prev, MPOOL_DIRTY);
+	} else
+		h->prevpg = P_INVALID;
+
+	return (h);
+}
+
+/*
+ * BL_INTERNAL -- Append a {key, page} entry to an internal level.
+ *
+ * A level is created when the level below gets its second page, with
+ * an empty key for the leftmost page (never compared, see __bt_cmp).
+ *
+ * Parameters:
+ *	t:	tree
+ *	lv:	levels being built
+ *	level:	level to append to, 1 being the parents of the leaves
+ *	bytes:	key
+ *	ksize:	key size
+ *	flags:	P_BIGKEY if the key is on an overflow page
+ *	pgno:	page the key leads to
+ *
+ * Returns:
+ *	RET_ERROR, RET_SUCCESS
+ */
+static int
+bl_internal(BTREE *t, BLEVEL *lv, int level,
+    const char *bytes, size_t ksize, u_char flags, pgno_t pgno)
+{
+	BINTERNAL *bi;
+	PAGE *h;
+	size_t nbytes;
+	char *dest;
+
+	if (level >= MAXLEVELS) {
+		errno = EINVAL;
+		return (RET_ERROR);
+	}
+
+	nbytes = NBINTERNAL(ksize);
+
+	if ((h = lv[level].page) == NULL) {
+		if ((h = bl_newpage(t, NULL, P_BINTERNAL)) == NULL)
+			return (RET_ERROR);
+		lv[level].page = h;
+		lv[level].first = h->pgno;
+
+		h->linp[0] = h->upper -= NBINTERNAL(0);
+		h->lower += sizeof(indx_t);
+		dest = (char *)h + h->upper;
+		WR_BINTERNAL(dest, 0, lv[level - 1].first, 0);
+	} else if (h->upper - h->lower < nbytes + sizeof(indx_t)) {
+		if ((h = bl_newpage(t, h, P_BINTERNAL)) == NULL)
+			return (RET_ERROR);
+		lv[level].page = h;
+
+		h->linp[0] = h->upper -= nbytes;
+		h->lower += sizeof(indx_t);
+		dest = (char *)h + h->upper;
+		WR_BINTERNAL(dest, ksize, pgno, flags);
+		memmove(dest, bytes, ksize);
+
+		bi = GETBINTERNAL(h, 0);
+		return (bl_internal(t, lv, level + 1,
+		    bi->bytes, ksize, flags, h->pgno));
+	}
+
+	h->linp[NEXTINDEX(h)] = h->upper -= nbytes;
+	h->lower += sizeof(indx_t);
+	dest = (char *)h + h->upper;
+	WR_BINTERNAL(dest, ksize, pgno, flags);
+	memmove(dest, bytes, ksize);
+
+	return (RET_SUCCESS);
+}
+
+/*
+ * BL_PRESERVE -- Mark an overflow chain referenced by an internal page.
+ *
+ * Parameters:
+ *	t:	tree
+ *	p:	pointer to { pgno_t, size_t }
+ *
+ * Returns:
+ *	RET_ERROR, RET_SUCCESS
+ */
+static int
+bl_preserve(BTREE *t, const char *p)
+{
+	PAGE *h;
+	pgno_t pg;
+
+	memmove(&pg, p, sizeof(pgno_t));
+	if ((h = mpool_get(t->bt_mp, pg, 0)) == NULL)
+		return (RET_ERROR);
+	h->flags |= P_PRESERVE;
+	mpool_put(t->bt_mp, h, MPOOL_DIRTY);
+	return (RET_SUCCESS);
+}
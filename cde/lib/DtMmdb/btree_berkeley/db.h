@@ -238,6 +238,7 @@ typedef struct {
 
 __BEGIN_DECLS
 DB *dbopen __P((const char *, int, int, DBTYPE, const void *));
+int __bt_load __P((const DB *, int (*)(void *, DBT *, DBT *), void *));
 
 #ifdef __DBINTERFACE_PRIVATE
 DB	*__bt_open __P((const char *, int, int, const BTREEINFO *, int));
@@ -67,6 +67,7 @@ int	 __bt_fd __P((const DB *));
 EPG	*__bt_first __P((BTREE *, const DBT *, int *));
 int	 __bt_free __P((BTREE *, PAGE *));
 int	 __bt_get __P((const DB *, const DBT *, DBT *, u_int));
+int	 __bt_load __P((const DB *, int (*)(void *, DBT *, DBT *), void *));
 PAGE	*__bt_new __P((BTREE *, pgno_t *));
 void	 __bt_pgin __P((void *, pgno_t, void *));
 void	 __bt_pgout __P((void *, pgno_t, void *));
@@ -71,6 +71,10 @@ public:
    //int r() { return v_r; };
    Boolean overflow() { return v_overflowed; };
 
+// next bucket in the overflow chain (linear hashing). 0: none
+   void set_overflow_bucket(int b) { v_next = b; sync_params(); };
+   int overflow_bucket() { return v_next; };
+
 // update
    int insert(data_t*);
    Boolean remove(int ind);
@@ -99,6 +103,8 @@ protected:
    page_storage* v_key_store;
 
    Boolean  v_overflowed;
+   int      v_next;
+   int      v_params_sz;
    //unsigned int v_k;
    //unsigned int v_r;
 
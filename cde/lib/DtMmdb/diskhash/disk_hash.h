@@ -69,10 +69,15 @@ class disk_hash : public index_agent
 public:
    disk_hash(page_storage* key_oid_store, 
              int prime = 32801, 
-             int expected_n = 100
+             int expected_n = 100,
+             Boolean linear = true
             ); 
                                // prime and expected
-                               // key set size 
+                               // key set size. A new store
+                               // grows by linear hashing 
+                               // unless linear is false.
+                               // An existing store keeps the
+                               // scheme it was created with.
    virtual ~disk_hash();
 
    Boolean insert(data_t& v);  // insert a key
@@ -83,6 +88,8 @@ public:
 
    //int no_keys() const { return n; }; // return key set size
 
+   Boolean linear() { return v_linear; };
+
 // WARNING:  -1 is the terminate condition!!!
    int first_bucket();
    disk_bucket* get_bucket(int&);
@@ -97,8 +104,9 @@ public:
 
 
 protected:
-   void init_params(int prime, int expected_n);
+   void init_params(int prime, int expected_n, Boolean linear);
    void sync_params();
+   void sync_segments();
 
    void set_M(unsigned int newM) { M = newM; };
    void set_v(unsigned int newv) { v = newv; };
@@ -114,6 +122,15 @@ protected:
 
    void caching(disk_bucket& b, data_t& w, int slot_num);
 
+// linear hashing
+   int linear_bucket(data_t& w) const;  // logical bucket of w
+   int linear_page(int b) const;        // bucket array index of b
+   Boolean _linear_insert(data_t& w);
+   int new_overflow_bucket();
+   void add_segment();
+   void split();
+   void grow();
+
    void out_params();
 
 protected:
@@ -125,6 +142,14 @@ protected:
 
    unsigned int n;        // current key set size
 
+// linear hashing only. M counts the primary buckets
+// and v heads the list of free overflow buckets.
+   Boolean v_linear;
+   unsigned int M0;       // initial number of buckets
+   unsigned int* v_segments; // first bucket of each segment
+   int v_max_segments;       // size of v_segments
+   Boolean v_chained;        // last insert went to an overflow bucket
+
    bucket_array* bucket_vector;  // bucket array
 
    void_ptr_array* hash_vector;  // hash array
@@ -65,9 +65,19 @@
 #include "hmphf/mphf_hash_table.h"
 #include "hmphf/pattern.h"
 
-int compute_a_mphf(char** keys, params& params_ptr, buffer& mphf_spec_buffer);
+// number of threads searching mappings concurrently. Taken from
+// MMDB_MPHF_THREADS if set, otherwise the number of online CPUs.
+int mphf_threads();
 
-int search(buckets& bs, mphf_hash_table& ht, params& pms);
+int compute_a_mphf(char** keys, params& params_ptr, buffer& mphf_spec_buffer,
+                   int threads = mphf_threads());
+
+// size of the g array per key for the current parameters
+float mphf_bits_per_key(params& pms);
+
+// returns -3 if *stop_r drops below pms.v_r during the search
+int search(buckets& bs, mphf_hash_table& ht, params& pms,
+           const volatile unsigned int* stop_r = 0);
 int verify(buckets& bs, mphf_hash_table& ht, params& pms);
 
 int write_spec(buckets& bs, params& pms, buffer& mphf_spec_buffer);
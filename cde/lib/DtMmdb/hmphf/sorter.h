@@ -63,6 +63,16 @@
 #include "utility/atoi_fast.h"
 #include "hmphf/buckets.h"
 
+class sorter;
+
+// a range of buckets filtered by one thread
+struct sorter_slice
+{
+   sorter* v_sorter;
+   int v_from;
+   int v_to;
+};
+
 class sorter 
 {
 
@@ -79,6 +89,7 @@ public:
 protected:
    void _init(istream&);
    void filter_by_hash();
+   static void* filter_slice(void*);
    void filter_a_bucket(bucketPtr bkt);
    void assemble_unique_keys();
 
@@ -55,6 +55,13 @@
 #include "index/dyn_index.h"
 #include "btree/mmdb_btree.h"
 
+// a key and one of its locations, collected during a batch load
+struct btree_batch_entry {
+   data_t* key;
+   oid_t loc;
+   int seq;
+};
+
 class btree_index : public dyn_index
 {
 
@@ -65,9 +72,26 @@ public:
 //init run time data members
    Boolean init_data_member( inv_lists_handler*, const char* btree_store );
 
+// batch load: keys are collected, sorted and bulk loaded into
+// the btree at batch_index_end()
+   virtual Boolean batch_index_begin() ;
+   virtual Boolean batch_index_end() ;
+   virtual Boolean insert_key_loc(const handler&, const oid_t&) ;
+   virtual Boolean insert_key_loc(const oid_t&, const oid_t&) ;
+
    size_t handler_to_inv_idx(const handler& query);
 
    MMDB_SIGNATURES(btree_index);
+
+protected:
+   void batch_append(data_t* key, const oid_t& loc);
+   void batch_clear();
+
+protected:
+   btree_batch_entry* v_batch;
+   int v_batch_sz;
+   int v_batch_cap;
+   Boolean v_batch_mode;
 };
 
    
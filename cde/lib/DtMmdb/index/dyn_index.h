@@ -81,6 +81,7 @@ public:
    virtual oid_list_handler* get_loc_list(const oid_t&);
    virtual oid_list_handler* get_loc_list(const handler&);
    virtual int invlist_length(handler&) ;
+   virtual int inv_list_pos(const handler& query);
 
 // status inquiry functions
    virtual Boolean sorted() const { return false; };  
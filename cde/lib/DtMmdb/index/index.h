@@ -102,6 +102,10 @@ public:
 // translate a query to an index of an inv_list
    virtual size_t handler_to_inv_idx(const handler& query) = 0;
 
+// the inv_list position of the query's list, 0 if there is none
+   virtual int inv_list_pos(const handler& query) = 0;
+   inv_lists_handler* get_inv_lists() { return v_inv_lists_hd; };
+
 // status inquiry functions
    int bound_to() const { return v_cmp_selector; } ;
    virtual Boolean sorted() const = 0;
@@ -53,6 +53,7 @@
 
 #include "storage/unixf_storage.h"
 #include "object/oid_list.h"
+#include "index/posting_list.h"
 
 class inv_lists : public oid_list
 {
@@ -63,7 +64,9 @@ public:
 
    MMDB_SIGNATURES(inv_lists);
 
-// get the invlist
+// get the invlist. A compressed list is returned as a memory 
+// resident copy: change it through posting_insert() and 
+// posting_remove(), not through the copy.
    virtual oid_list_handler* get_list(int index) ;
 //   virtual oid_list_handler* get_list(mmdb_pos_t pod) ;
 
@@ -73,9 +76,34 @@ public:
    Boolean remove_list(int index);
    void insert_to_list(int index, oid_t& id);
 
+// add an oid to, or remove it from, a compressed list in place
+   void posting_insert(int index, const oid_t& id) 
+      { posting_change(index, id, true); };
+   void posting_remove(int index, const oid_t& id)
+      { posting_change(index, id, false); };
+
+// oids common to list i and list j of other (which may be this),
+// in sorted order and with instance codes only. Two compressed
+// lists are intersected on their skip tables, others on sorted
+// arrays of their codes.
+   oid_list_handler* intersect_lists(int i, inv_lists& other, int j);
+
+// every non-ground slot holds a posting_list when set, an oid_list
+// otherwise. Set from the schema (inv_desc) each time the index is
+// opened, so the kind of a slot never has to be guessed from the
+// slot itself.
+   void set_compressed(Boolean x) { f_compressed = x; };
+   Boolean compressed() { return f_compressed; };
+
 // I/O function
    friend ostream& operator <<(ostream&, inv_lists&) ;
 
+protected:
+   void posting_change(int index, const oid_t& id, Boolean add);
+   i_code_t* sorted_codes(int index, int& n);
+
+protected:
+   Boolean f_compressed;
 };
 
 HANDLER_SIGNATURES(inv_lists)
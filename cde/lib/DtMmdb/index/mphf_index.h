@@ -98,6 +98,7 @@ public:
 
 //
    size_t handler_to_inv_idx(const handler& query);
+   virtual int inv_list_pos(const handler& query);
 
 // status inquiry functions
    virtual Boolean sorted() const { return false; };  
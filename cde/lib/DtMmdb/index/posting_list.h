@@ -0,0 +1,123 @@
+/*
+ * CDE - Common Desktop Environment
+ *
+ * Copyright (c) 1993-2012, The Open Group. All rights reserved.
+ *
+ * These libraries and programs are free software; you can
+ * redistribute them and/or modify them under the terms of the GNU
+ * Lesser General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option)
+ * any later version.
+ *
+ * These libraries and programs are distributed in the hope that
+ * they will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with these libraries and programs; if not, write
+ * to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+ * Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef _posting_list_h
+#define _posting_list_h 1
+
+#include "object/pstring.h"
+#include "object/oid_list.h"
+
+#define POSTING_BLOCK_SZ 64
+
+///////////////////////////////////////////////////////////////
+// A compressed inverted list. Instance codes are kept sorted
+// and stored as variable-byte deltas in blocks of 
+// POSTING_BLOCK_SZ codes. A skip table in front of the blocks 
+// holds the first code and the byte offset of each block, so
+// that a search can jump over whole blocks.
+//
+// Layout (every field variable-byte coded, so the bytes do not
+// depend on the byte order of the store):
+//
+//	count, no. of blocks, 
+//	(first code, block offset) * no. of blocks,
+//	(delta) * (count - no. of blocks)
+///////////////////////////////////////////////////////////////
+
+class posting_list : public pstring
+{
+
+public:
+   posting_list(c_code_t = POSTING_LIST_CODE);
+   virtual ~posting_list();
+
+   MMDB_SIGNATURES(posting_list);
+
+// replace the content with the oids in the list (order not required)
+   using pstring::update;
+   Boolean update(oid_list&);
+
+// number of oids in the list
+   int count();
+
+// decode into a memory resident oid_list
+   oid_list_handler* expand();
+};
+
+HANDLER_SIGNATURES(posting_list)
+
+///////////////////////////////////////////////////////////////
+// sequential and skipping access to an encoded posting list
+///////////////////////////////////////////////////////////////
+
+class posting_cursor
+{
+
+public:
+   posting_cursor(posting_list&);
+   posting_cursor(const char* encoded, int sz);
+   ~posting_cursor();
+
+   int count() { return f_count; };
+
+// get the next code. Return false at the end of the list.
+   Boolean next(i_code_t&);
+
+// get the first remaining code that is >= target, using the
+// skip table to bypass blocks. Return false if there is none.
+   Boolean seek(i_code_t target, i_code_t&);
+
+protected:
+   void _init(const char*, int);
+
+protected:
+   char* f_data;
+   const unsigned char* f_blocks_base;
+   const unsigned char* f_ptr;
+
+   int f_count;
+   int f_no_blocks;
+   i_code_t* f_skip_first;
+   int* f_skip_offset;
+
+   int f_pos;          // codes consumed so far
+   int f_block;        // block holding the last consumed code
+   i_code_t f_last;    // last consumed code
+};
+
+void posting_sort(i_code_t* codes, int n);
+
+// encode n instance codes (sorted in place) into out
+void posting_encode(i_code_t* codes, int n, buffer& out);
+
+// intersect two sorted code arrays, galloping through the
+// longer one. Return the number of codes written to out.
+int posting_intersect(const i_code_t* a, int na, 
+                      const i_code_t* b, int nb, i_code_t* out);
+
+// intersect two encoded lists by leapfrogging seek()s.
+// out must hold MIN(a.count(), b.count()) codes.
+int posting_intersect(posting_cursor& a, posting_cursor& b, i_code_t* out);
+
+#endif
@@ -63,6 +63,8 @@ public:
    query_mgr_t();
    virtual ~query_mgr_t();
 
+// all three fill in and return the same query handler. Readers
+// in multi-reader mode form their own queries instead.
    handler& form_pstring_handler(const char* q_string);
    handler& form_integer_handler(int q_int);
    handler& form_oid_handler(const oid_t& q_oid);
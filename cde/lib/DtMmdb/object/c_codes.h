@@ -64,6 +64,7 @@
 #define OID_T_CODE 		9
 #define DL_LIST_CELL_CODE	10
 #define COMPRESSED_STRING_CODE	11
+#define POSTING_LIST_CODE	12
 
 #define COMPOSITE_CODE 		101
 #define TUPLE_CODE 		102
@@ -91,6 +91,17 @@ public:
    char* get(buffer& optional_buffer = v_cp_io_buf); 
 #endif
 
+// get() in two steps, so that each can be timed: the string as
+// stored, then its decompression into optional_buffer
+   char* get_compressed(buffer& compressed_buffer);
+#ifdef C_API
+   char* decompress(buffer& compressed_buffer,
+                    buffer& optional_buffer = *v_cp_io_buf_ptr);
+#else
+   char* decompress(buffer& compressed_buffer,
+                    buffer& optional_buffer = v_cp_io_buf);
+#endif
+
    int size() const; // get uncompressed data size
 
    MMDB_SIGNATURES(compressed_pstring);
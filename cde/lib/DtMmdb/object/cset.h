@@ -99,6 +99,11 @@ public:
 // 'index' indicates the index to be used. 
    virtual oid_list_handler* get_locs(handler& query, int index);
 
+// get the locs of element objects satisfying both queries, each on
+// its own index. The oids returned carry instance codes only.
+   virtual oid_list_handler* get_locs(handler& query1, int index1,
+                                      handler& query2, int index2);
+
    virtual oid_t get_first_oid(const handler& query, int index);
 
 // get a pointer to an index
@@ -53,6 +53,8 @@
 
 #include "object/oid_list.h"
 
+#define MAX_COMPS 50
+
 /***************************************
 * tuple class.
 ****************************************/
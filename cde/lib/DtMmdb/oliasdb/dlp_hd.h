@@ -70,6 +70,10 @@ public:
 
    handler* get_component(int) ;
 
+// set the node and whether the cell begins and/or terminates
+// a book section (see asciiIn()).
+   void set(const oid_t& node, Boolean beg, Boolean term);
+
 // in/out functions
    io_status asciiOut(ostream&);
    io_status asciiIn(istream&);
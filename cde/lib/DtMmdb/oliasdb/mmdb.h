@@ -73,8 +73,11 @@ public:
 
    info_lib* openInfoLib(const char* path = getenv("MMDB_PATH"), 
                          const char* selectedBookCaseName = 0,
-			 const char* infoLibName = "InfoLibrary"
+			 const char* infoLibName = "InfoLibrary",
+                         Boolean lazyBases = false
                         );
+   // lazyBases defers opening each bookcase's stores until it
+   // is first used (see info_base::open()).
    // NOTE: default argument ("InfoLibrary") needs to be abandoned.
    void closeInfoLib(const char* infoLibUid = "InfoLibrary");
    info_lib* getInfoLib(int descriptor);
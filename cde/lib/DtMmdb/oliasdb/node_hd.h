@@ -98,6 +98,10 @@ public:
    const char* short_title();
    const char* data();
    int data_size();
+
+// the data string itself (a pstring or a compressed_pstring),
+// for reading it in steps. The caller deletes the handler.
+   handler* data_handler();
    const char* toc_node_loc();
    oid_t doc_id();
 
@@ -109,6 +113,7 @@ public:
 // portion to a set of centeralized pages
 /////////////////////////////////////////////////////////////
    Boolean update_data(istream&);
+   Boolean update_data(const char* buf, int size);
 
 /////////////////////////////////////////////////////////////
 // this function is for update the doc id field so that
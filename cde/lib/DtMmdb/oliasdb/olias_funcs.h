@@ -62,5 +62,22 @@ int load_mixed_objects_from_cin(info_base*);
 int load_mixed_objects(info_base*, istream&);
 
 void connectNodeToDoc(info_lib*); // update doc id fields in all node objects
+void _connectNodeToDoc(info_base*);
+
+// batch loading of the mixed collections (doc, toc, loc, graphic and
+// dlp). mixed_store() returns the store in which to create an object
+// of class ccode and mixed_insert() adds the object to its collection.
+// Both are valid between mixed_load_begin() and mixed_load_end().
+void mixed_load_begin(info_base*);
+void mixed_load_end();
+abs_storage* mixed_store(c_code_t ccode);
+void mixed_insert(c_code_t ccode, handler&);
+
+// rewrite the page layouts of the base's stores in this machine's
+// byte order. Object data are not converted: they keep the order the
+// base was built in and are still swapped as they are read. Converted
+// stores carry version MAJOR.PAGE_ORDER_MINOR, which older code
+// rejects as a version mismatch.
+int convert_page_order(info_base*);
 
 #endif
@@ -0,0 +1,109 @@
+/*
+ * CDE - Common Desktop Environment
+ *
+ * Copyright (c) 1993-2012, The Open Group. All rights reserved.
+ *
+ * These libraries and programs are free software; you can
+ * redistribute them and/or modify them under the terms of the GNU
+ * Lesser General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option)
+ * any later version.
+ *
+ * These libraries and programs are distributed in the hope that
+ * they will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with these libraries and programs; if not, write
+ * to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+ * Floor, Boston, MA 02110-1301 USA
+ */
+
+
+#ifndef _record_loader_h
+#define _record_loader_h 1
+
+#include "api/info_base.h"
+#include "object/tuple.h"
+#include "object/short_list.h"
+
+///////////////////////////////////////////////////////////////
+// Loads objects into an infobase from typed records, without
+// going through the ASCII load format. A record_loader either
+// fills one named set of the base (as "dbdrv stdin_load" does) or
+// the mixed collections doc, toc, loc, graphic and dlp plus the
+// clustered SGML data of the nodes (as "dbdrv mixed_load" does).
+//
+// An object is given by begin_object(), one add_xxx() call per
+// component in schema order, and end_object(). Between
+// begin_short_list() and end_short_list(), the add_xxx() calls
+// append items to a short list component instead.
+///////////////////////////////////////////////////////////////
+
+class record_loader
+{
+
+public:
+// set_name is the name of the set in the base ("stylesheet",
+// "node", etc.), or 0 to load the mixed collections.
+   record_loader(info_base*, const char* set_name = 0);
+   virtual ~record_loader();
+
+// finish the batch: build the indices of the collections and, for
+// a mixed load, connect the nodes to their docs. Must be called once
+// all records are in; the destructor does not call it.
+   void end();
+
+// objects
+   void begin_object(c_code_t class_code, int comps);
+   void end_object();
+
+// components
+   void add_string(const char* str, int len);
+   void add_compressed_string(const oid_t& agent, const char* str, int len);
+   void add_oid(const oid_t&);
+   void add_integer(int);
+   void add_oid_list(const oid_t* oids, int qty);
+
+   void begin_short_list();
+   void end_short_list();
+
+// dlp cells. A cell is kept back until the next one arrives so that
+// end_dlp_section() can mark it as the last of a book section.
+   void add_dlp(const oid_t& node, Boolean first_in_section);
+   void end_dlp_section();
+
+// the SGML data of the node with the locator
+   void add_sgml_content(const char* locator, const char* data, int len);
+
+// no. of objects loaded so far
+   int objects() { return f_objects; };
+
+protected:
+   abs_storage* component_store();
+   void add_component(handler*);
+   void flush_dlp(Boolean term);
+
+protected:
+   info_base* f_base;
+   cset_handlerPtr f_set;	// 0 for a mixed load
+   Boolean f_ended;
+
+   c_code_t f_ccode;
+   abs_storage* f_store;	// store of the current object
+   mmdb_tuple_handler* f_obj;
+   int f_comps;
+   int f_comp;
+
+   short_list_handler* f_list;
+
+   oid_t f_dlp_node;
+   Boolean f_dlp_first;
+   Boolean f_dlp_pending;
+
+   int f_objects;
+};
+
+#endif
@@ -32,11 +32,19 @@ class inv_desc : public stored_object_desc {
 
 public:
    inv_desc();
-   virtual ~inv_desc() {};
+   virtual ~inv_desc();
 
    handler* init_handler(object_dict&) ;
+
+// list representation: "oid_list" (default) or "vbyte" 
+// (compressed posting_lists)
+   void set_posting(const char*);
+   Boolean compressed();
+
+   virtual ostream& asciiOut(ostream& out, Boolean last = true);
  
 protected:
+   char* posting_str;
 };
 
 
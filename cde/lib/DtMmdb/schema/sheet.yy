@@ -79,6 +79,7 @@ extern int yylex();
  INV
  COMPRESS
  INV_NAME
+ POSTING
  AGENT_NAME
  STORE_NAME
  POSITION 
@@ -268,10 +269,10 @@ MPHF_index_descriptions: MPHF_Index_Term SEPARATOR MPHF_index_descriptions
         {
         }
 
-Inv_descriptions: Stored_Object_Term SEPARATOR Inv_descriptions
+Inv_descriptions: Inv_Term SEPARATOR Inv_descriptions
         {
         }
-        | Stored_Object_Term 
+        | Inv_Term 
         {
         }
 
@@ -357,6 +358,14 @@ Stored_Object_Term : STORE_NAME EQUAL TOKEN
 	{
 	}
 
+Inv_Term: POSTING EQUAL TOKEN
+	{
+           CAST_TO_INV(desc_ptr) -> set_posting($3);
+	}
+	| Stored_Object_Term
+	{
+	}
+
 Container_Term: INDEX_NAME EQUAL TOKEN
 	{
            CAST_TO_CONTAINER(desc_ptr) -> set_index_nm($3);
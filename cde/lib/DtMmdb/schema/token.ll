@@ -109,6 +109,10 @@ int linecount = 1;
          return(BTREE_INDEX);
         }
 
+"posting"	{
+         return(POSTING);
+        }
+
 "inv_nm"	{
          return(INV_NAME);
         }
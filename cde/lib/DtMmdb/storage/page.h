@@ -115,6 +115,7 @@ public:
 
    friend class page_storage;
    friend class page_cache_global_part;
+   friend class page_cache_shard;
    friend class dyn_hash;
 
 
@@ -33,6 +33,8 @@ class page_storage;
 
 #include "dstr/bset.h"
 
+#include <pthread.h>
+
 class page_cache_local_part
 {
 
@@ -87,6 +89,9 @@ public:
 
    ostream& print_cached_pages(ostream&); // show cached pages.
 
+// write out all dirty pages
+   void sync_pages();
+
    friend class page_cache_local_part;
    friend class page_storage;
    friend void remove_from_global_cache(const void*);
@@ -96,4 +101,142 @@ protected:
    lru             f_replace_policy;
 };
 
+//////////////////////////////////////////////////////////////////////
+// Sharded page cache used in multi-reader mode (see
+// page_storage::set_multi_reader()). A page maps to one of
+// MMDB_PAGE_SHARDS shards by its store and page number. Each shard has
+// its own lock, hash index and LRU list, so readers of different
+// shards never wait on each other. Pages are only valid while the
+// shard lock is held.
+//////////////////////////////////////////////////////////////////////
+
+#define MMDB_PAGE_SHARDS 16
+#define MIN_MMDB_SHARD_PAGES 4
+
+class shard_frame
+{
+public:
+   shard_frame(page_storage* st, int page_num, page* p) :
+      f_store(st), f_page_num(page_num), f_page(p),
+      f_hash_next(0), f_prev(0), f_next(0) {};
+
+   page_storage* f_store;
+   int           f_page_num;
+   page*         f_page;
+
+   shard_frame*  f_hash_next;
+   shard_frame*  f_prev;       // more recently used
+   shard_frame*  f_next;       // less recently used
+};
+
+class page_cache_shard
+{
+
+public:
+   page_cache_shard();
+   ~page_cache_shard();
+
+   void set_params(int max_frames);
+
+   void lock() { pthread_mutex_lock(&f_lock); };
+   void unlock() { pthread_mutex_unlock(&f_lock); };
+
+// return page 'page_num' of the store, reading it in if necessary.
+// The caller holds the lock.
+   page* get(page_storage* st, int page_num);
+
+// drop the pages of a store, or all pages
+   void remove_pages(page_storage* st);
+   void clear();
+
+   unsigned int hits() { return f_hits; };
+   unsigned int misses() { return f_misses; };
+
+protected:
+   void _init(int max_frames);
+   unsigned int _bucket(page_storage* st, int page_num);
+   void _unlink(shard_frame*);
+   void _push_front(shard_frame*);
+   void _unhash(shard_frame*);
+   void _free(shard_frame*);
+
+protected:
+   pthread_mutex_t f_lock;
+
+   shard_frame**   f_buckets;
+   unsigned int    f_num_buckets;
+
+   shard_frame*    f_head;     // most recently used
+   shard_frame*    f_tail;     // least recently used
+
+   int             f_frames;
+   int             f_max_frames;
+
+   unsigned int    f_hits;
+   unsigned int    f_misses;
+};
+
+// holds a shard lock for the life time of the object
+class page_shard_lock
+{
+public:
+   page_shard_lock(page_cache_shard& x) : f_shard(x) { f_shard.lock(); };
+   ~page_shard_lock() { f_shard.unlock(); };
+
+protected:
+   page_cache_shard& f_shard;
+};
+
+class page_cache_shards
+{
+
+public:
+   page_cache_shards();
+   ~page_cache_shards();
+
+   void set_params(unsigned int total_allowed_pages);
+
+   page_cache_shard& shard(page_storage* st, int page_num) {
+      return f_shards[
+         (((unsigned long)st >> 4) + (unsigned int)page_num) % MMDB_PAGE_SHARDS
+                     ];
+   };
+
+   void remove_pages(page_storage* st);
+   void clear();
+
+   ostream& print_stats(ostream&);
+
+// page construction and destruction share static state with
+// page::operator new/delete; frames of both caches are allocated
+// and freed under this lock.
+   static pthread_mutex_t f_alloc_lock;
+
+protected:
+   page_cache_shard f_shards[MMDB_PAGE_SHARDS];
+};
+
+//////////////////////////////////////////////////////////////////////
+// Object lock of multi-reader mode. Only readString() is safe without
+// it: handler and object materialization, the object templates, index
+// queries and the global page cache behind get_str_ptr() all share
+// state, and run under this one recursive lock. Objects are used by
+// one thread at a time; handlers may be shared. A no-op unless the
+// mode is on.
+//////////////////////////////////////////////////////////////////////
+
+class multi_reader_lock
+{
+public:
+   multi_reader_lock();
+   ~multi_reader_lock();
+
+protected:
+   Boolean f_locked;
+
+   static pthread_mutex_t f_lock;
+   static pthread_once_t f_once;
+   static void _init_lock();
+};
+
 #endif
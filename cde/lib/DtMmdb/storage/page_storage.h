@@ -118,6 +118,7 @@ public:
 
 #ifdef C_API
 #define f_global_pcache (*f_global_pcache_ptr)
+#define f_page_shards (*f_page_shards_ptr)
 #endif
 
 
@@ -134,10 +135,14 @@ protected:
 
 #ifndef C_API
    static page_cache_global_part f_global_pcache;
+   static page_cache_shards f_page_shards;
 #else
    static page_cache_global_part* f_global_pcache_ptr;
+   static page_cache_shards* f_page_shards_ptr;
 #endif
 
+   static Boolean f_multi_reader;
+
    page_cache_local_part f_local_pcache;
 
    int total_pages;
@@ -145,6 +150,8 @@ protected:
 // byte order 
    int v_server_order;
    int v_db_order;
+   int v_page_order;   // order of the page layouts (count and
+                       // slot headers). Normally v_db_order.
 
    buffer* v_buf; 	   // aux. buf.
 
@@ -156,6 +163,9 @@ protected:
    Boolean seek_loc_negative(mmdb_pos_t& loc, int smd);
    Boolean seek_loc_positive(mmdb_pos_t& loc, int smd);
 
+   int shared_readString(mmdb_pos_t loc, char* base, int len, int str_offset);
+   void load_shared_page(page*, int page_num);
+
 public:
    page_storage(char* path, char* name,
                 unixf_storage* store, 
@@ -176,10 +186,34 @@ public:
    void roll_back();
    void save_to_log(page* page_ptr);
 
+// Multi-reader mode. While on, readString() may be called from
+// several threads at once: pages come from a sharded cache with
+// per-shard locks and are read with pread(). Everything else runs
+// under multi_reader_lock (page_cache.h), which handlers, the
+// template manager, cset/dl_list queries and smart_ptr take. Dirty
+// pages are written out when the mode is entered, and nothing may
+// modify any store while it is on. Switch it only while no other
+// thread uses the database.
+   static void set_multi_reader(Boolean);
+   static Boolean multi_reader() { return f_multi_reader; };
+
 // get server and db order
    int server_order() { return v_server_order; } ;
    int db_order() { return v_db_order; };
 
+// page layouts are swapped on each page load when their order
+// differs from the server's. Object data are swapped field by
+// field by their readers, as before, and are not affected.
+   int page_order() { return v_page_order; };
+   Boolean page_swap_order() { 
+      return ( v_page_order != v_server_order ) ? true : false; 
+   };
+
+// rewrite all pages with their layouts in the given order and
+// record it in the store header. Offline use only: the store must
+// be writable and not shared with other processes.
+   void set_page_order(int order);
+
 
 // i/o functions
    int readString (mmdb_pos_t loc, char* base, int len, int str_offset = 0); 
@@ -241,6 +275,7 @@ public:
    friend class handler;
    friend class page_cache_local_part;
    friend class page_cache_global_part;
+   friend class page_cache_shard;
 
 #ifdef C_API
    friend void initialize_MMDB();
@@ -53,6 +53,7 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <pthread.h>
 
 #include "utility/funcs.h"
 #include "storage/lru.h"
@@ -70,6 +71,10 @@ protected:
    int _open(int mode);
    Boolean v_file_exist;
 
+   int f_rd_fd;                  // descriptor for positional reads
+
+   static pthread_mutex_t f_rd_lock;
+
 public:
 // mode: see ios::in etc. stuff in file iostream.h 
    unixf_storage( char* file_path, 
@@ -86,6 +91,12 @@ public:
    int appendString(mmdb_pos_t loc, const char*, int len, Boolean flush_opt = false);
    int updateString(mmdb_pos_t loc, const char* base, int len, int string_ofst = 0, Boolean flush = false);
 
+// Read with pread(2) on a separate descriptor, leaving the stream
+// alone. Safe to call from several threads at once as long as nobody
+// writes to the store. It sees only what has been flushed, which
+// page_storage does on every page write. Returns the bytes read.
+   int preadString(mmdb_pos_t loc, char*, int len);
+
 
 // non-applicable funcs
    int insertString(mmdb_pos_t& , const char* , int, Boolean = false)
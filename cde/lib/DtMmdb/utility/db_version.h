@@ -28,5 +28,10 @@
 #define MAJOR 2
 #define MINOR 3
 
+// minor version stamped on stores of version MAJOR.MINOR whose
+// page layouts are in the byte order opposite to their data
+// (see page_storage::set_page_order()). Must stay above MINOR.
+#define PAGE_ORDER_MINOR 4
+
 #endif
 
@@ -30,8 +30,10 @@ class DataRepository;
 class AusTextStore {
 private:
   FILE *afp;
+  FILE *bfp;		/* section to book map, <BookCaseName>.bkm */
   char *austext_path;
   static unsigned long f_recordcount;
+  static int f_bkmopened;	/* bkm file truncated by this parser run */
   
 public:
 
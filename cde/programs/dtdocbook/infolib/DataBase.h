@@ -29,6 +29,7 @@
 #include "object/c_codes.h" /* mmdb codes */
 #include "oliasdb/olias_consts.h"
 #include <errno.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -58,6 +59,7 @@ private:
 #define DATABASE_STDIO "-"
 
 class DBTable;
+class record_loader;
 
 class DB{
 public:
@@ -70,6 +72,17 @@ public:
   ~DB() { if ( f_name ) delete f_name; }
   const char *path(void) { return f_name; };
 
+  /*
+   * USE: record_loader loader(base_ptr, "node");
+   *      db.set_loader(&loader);
+   *
+   * Records inserted into DATABASE_STDIO tables created afterwards
+   * go straight into the infobase through the loader, as typed
+   * values, instead of being written to stdout in the ASCII load
+   * format.  0 restores stdout.
+   */
+  void set_loader(record_loader *loader) { f_loader = loader; };
+
 
   typedef enum { READ, CREATE
 #if DB_UPDATE
@@ -94,6 +107,7 @@ public:
 
 private:
   char *f_name;
+  record_loader *f_loader;
   
 };
 
@@ -129,12 +143,17 @@ public:
   void end_list();
   
 protected:
-  DBTable(DB* database, int schema_code, int cols, const char *name);
+  DBTable(DB* database, int schema_code, int cols, const char *name,
+	  record_loader *loader = 0);
 
   FILE *file(DB::Access);
+
+  void load(int typecode, va_list ap);
+  void load_untagged(int typecode, va_list ap);
   
 private:
   FILE *f_file;
+  record_loader *f_loader;
   DB *f_database;
   int f_schema_code;
   int f_cols;
@@ -54,6 +54,7 @@ protected:
   static void subdoc_start();
   static void subdoc_end();
   static void data  ( FlexBuffer * );
+  static void data  ( const char *, size_t );
   static void setRoot( Task *t, Stack<int> *istack);
   static void setTempDir ( const char *tmpdir );
   static void setSrcDir  ( const char *srcdir );
@@ -70,11 +71,18 @@ private:
 
   static char *f_file;
   static int   f_line;
+
+  // ESIS tokens passed to the tasks: start and end tags and entity
+  // references, and data runs
+  static long  f_markup_tokens;
+  static long  f_data_tokens;
   
 public:  
   static SGMLDefn *entity_ref ( const char *ename );
   static int OutsideIgnoreScope() { return IgnoreStack->empty(); }
   static int       RunTocGenOnly() { return(tocgen_only); }
+  static long      markup_tokens() { return(f_markup_tokens); }
+  static long      data_tokens() { return(f_data_tokens); }
 #ifdef SC3
   static const char *GetTmpDir()       { return( tmpdir ); }
   static const char *GetSrcDir()       { return( srcdir ); } 
@@ -91,8 +99,19 @@ inline
 void
 Dispatch::data( FlexBuffer *buf )
 {
-  TaskObject->data( (const char *)( buf->GetBuffer() ),
-		    buf->GetSize() );
+  data( (const char *)( buf->GetBuffer() ), buf->GetSize() );
+}
+
+/*
+ * chars is passed on as is to all the tasks, so it has to stay put
+ * until the call returns and be null terminated like a FlexBuffer.
+ */
+inline
+void
+Dispatch::data( const char *chars, size_t len )
+{
+  f_data_tokens++;
+  TaskObject->data( chars, len );
 }
 
 #endif
@@ -38,6 +38,14 @@ private:
   char *HeadPtr;
 
   void grow(size_t);
+
+  // Storage of destroyed buffers, kept for reuse by new ones so
+  // that short-lived buffers don't go back to the allocator.
+  enum { PoolSlots = 32, PoolMaxBlock = 64 * 1024 };
+
+  static char *pool[PoolSlots];
+  static int   poolSize[PoolSlots];
+  static int   poolUsed;
   
 public:
   void write( const char *ch, size_t n );
@@ -50,7 +58,7 @@ public:
   const char *GetBuffer()  { grow(pos); HeadPtr[pos] = 0; return(HeadPtr); }
 
   FlexBuffer();
-  ~FlexBuffer() { delete [] HeadPtr; }
+  ~FlexBuffer();
  
   FlexBuffer &operator+ ( FlexBuffer & );
 
@@ -169,15 +169,32 @@ unsigned char oct2dec( const char *str )
                                  }
 <ProcessData>\n            {
                              Dispatch::data( DataBuffer );
-                             delete DataBuffer;
-                             DataBuffer = new FlexBuffer;
+                             DataBuffer->reset();
+
+			     BEGIN(0);
+			   }
+
+<ProcessData>[^\n\\]+\n    {
+                             // The rest of the data line, with no escapes.
+                             // Unless escapes came before it, hand it to
+                             // the tasks right out of the scanner's buffer.
+                             yytext[yyleng - 1] = '\0';
+
+                             if ( DataBuffer->GetSize() == 0 ) {
+                               Dispatch::data( (const char *)yytext,
+					       yyleng - 1 );
+                             }
+                             else {
+                               DataBuffer->write( (char*)yytext, yyleng - 1 );
+                               Dispatch::data( DataBuffer );
+                               DataBuffer->reset();
+                             }
 
 			     BEGIN(0);
 			   }
 
 <ProcessData>[^\n\\]+      {
-                             DataBuffer->write( (char*)yytext,
-						strlen((char*)yytext) );
+                             DataBuffer->write( (char*)yytext, yyleng );
                            }
 
 <ProcessData>.             {
@@ -194,6 +211,15 @@ unsigned char oct2dec( const char *str )
 			     
 %%
 
+//---------------------------------------------------------------------
+// Scan fp through an input buffer of size bytes. Data lines that fit
+// in it are passed to the tasks in place.
+void
+yyinput_buffer( FILE *fp, int size )
+{
+  yy_switch_to_buffer( yy_create_buffer( fp, size ) );
+}
+
 #ifdef DEBUG
 //---------------------------------------------------------------------
 #include "OLAF.h"  
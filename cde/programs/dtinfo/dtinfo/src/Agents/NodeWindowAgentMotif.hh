@@ -160,6 +160,7 @@ friend class Ancestor;
   void reattach( UAS_Pointer<Graphic> &);
 
   NodeViewInfo *node_view_info() { return f_node_view_info; }
+  DtHelpDispAreaStruct *help_display_area() { return f_help_dsp_area; }
 
   void popup_menu(XButtonPressedEvent*);  // popup detach graphic menu
   void detach_gr(); // for detach popup menu
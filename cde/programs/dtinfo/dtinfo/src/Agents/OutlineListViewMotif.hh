@@ -57,6 +57,14 @@ class LibraryAgent;
 
 #include <WWL/WXmList.h>
 
+// One per visible list position.  The XmList holds a shared placeholder
+// string for a row until it scrolls into view and is materialized. 
+struct OutlineRow
+{
+  OutlineElement *f_element;
+  bool            f_ready;
+};
+
 class OutlineListView : public WWL, public WXmList, public FolioObject
 {
 
@@ -103,10 +111,23 @@ public:  // functions
 
   void update_list (OutlineList *list, BitHandle handle);
 
+  // Materialize the rows now in the viewport.  Call after changing
+  // TopItemPosition directly. 
+  void fill_viewport();
+
 protected: // functions
   void regen_list();
-  void generate_table (OutlineList *list, XmStringTable &table,
-		       bool *selected_list, u_int level, unsigned force = 0);
+  void set_rows (OutlineList *list, u_int count);
+  void generate_rows (OutlineList *list, OutlineRow *rows, u_int level);
+  u_int expand_rows (OutlineElement *, u_int row);
+  void contract_rows (OutlineElement *, u_int row);
+  void reserve_rows (u_int count);
+  void materialize (u_int first, u_int count);
+  void replace_item (XmString item, u_int position);
+  static Boolean fill_ahead_wp (XtPointer);
+  Boolean fill_ahead();
+  void scrolled (WCallback *);
+  static void list_event (Widget, XtPointer, XEvent *, Boolean *);
   void set_icon (OutlineElement *);
   void set_track_icon (OutlineElement *, u_int position, char icon);
   void register_actions ();
@@ -154,4 +175,12 @@ protected: // view variables
   u_int           f_tracking_position;
   OutlineElement *f_tracking_element;
   LibraryAgent   *f_library_agent;
+
+  OutlineRow     *f_rows;	    // element at each list position
+  u_int           f_row_count;
+  u_int           f_row_max;
+  XmString        f_placeholder;
+  XtWorkProcId    f_fill_proc;
+  bool            f_stats;
+  u_int           f_materialized;
 };
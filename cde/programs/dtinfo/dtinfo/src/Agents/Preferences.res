@@ -190,3 +190,5 @@ Dtinfo*MapAutoUpdate:    true
 Dtinfo*NodeHistSize:     100
 Dtinfo*SearchHistSize:   50
 Dtinfo*MaxSearchHits:    50
+Dtinfo*NodeCacheSize:    4096
+Dtinfo*GraphicsCacheSize: 8192
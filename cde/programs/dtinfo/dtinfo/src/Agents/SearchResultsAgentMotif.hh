@@ -77,6 +77,8 @@ public: // functions
 
   ResultID *resultID()
     { return f_results; }
+  void close ()
+    { close_window (NULL); }
 
   static Boolean fill_list_wp (XtPointer client_data);
   Boolean fill_list(UAS_List<UAS_SearchResultsEntry> &);
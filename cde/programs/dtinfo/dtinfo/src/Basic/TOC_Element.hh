@@ -75,4 +75,5 @@ private:
 private:
   UAS_Pointer<UAS_Common>  f_toc;
   UAS_String fDisplayAs;
+  bool f_display_as_valid;
 };
@@ -60,10 +60,12 @@ class DisplayGraphic;
 #endif
 
 class Graphic;
+class GraphicEntry;
 
 class GraphicsMgr : public Long_Lived,
                     public UAS_Sender<DetachGraphic>,
-                    public UAS_Sender<ReAttachGraphic>
+                    public UAS_Sender<ReAttachGraphic>,
+                    public UAS_Receiver<UAS_LibraryDestroyedMsg>
 {
 friend class Graphic;
 public: // functions
@@ -85,6 +87,8 @@ public: // functions
   PixmapGraphic *detached_graphic();
   void reattach_graphic(UAS_Pointer<Graphic> &);
 
+  void receive (UAS_LibraryDestroyedMsg &msg, void *client_data);
+
 
 private:
   // called only from Graphic to fill it in 
@@ -94,11 +98,27 @@ private:
 
   PixmapGraphic *find(const UAS_Pointer<Graphic> &);
 
+  // called by Graphic when it has decoded another pixmap
+  void decoded (Graphic *);
+
+  void unlink_graphic (GraphicEntry *);
+  void trim_graphics();
+  void flush_graphics();
+
 private: // variables
 
-  xList<Graphic * >	  f_graphic_cache ;
   xList<GraphicAgent * >  f_detached_list ; // list of detached graphics
 
+  // graphics by locator, most recently used first 
+  GraphicEntry		**f_graphic_table ;
+  GraphicEntry		 *f_graphics ;
+  GraphicEntry		 *f_graphics_last ;
+  unsigned long		  f_graphics_bytes ;	// decoded pixmaps held 
+  unsigned long		  f_graphics_limit ;
+  bool			  f_graphics_stats ;
+  unsigned int		  f_graphics_hits ;
+  unsigned int		  f_graphics_misses ;
+
 private:
   LONG_LIVED_HH(GraphicsMgr,graphics_mgr);
 };
@@ -115,13 +135,16 @@ LONG_LIVED_HH2(GraphicsMgr,graphics_mgr);
 //
 
 class Graphic: public UAS_Base {
+    friend class GraphicsMgr;
     public:
 	Graphic (UAS_Pointer<UAS_Common> &doc, const UAS_String &locator):
 		fPixmap (0),
 		fDetachedPixmap (0),
 		fDetached (0),
 		fObj (doc->create_embedded_object (locator)),
-                fagent(NULL) {
+                fagent(NULL),
+		fScaled (NULL),
+		fEntry (NULL) {
 	}
 
 	~Graphic () {
@@ -132,6 +155,7 @@ class Graphic: public UAS_Base {
 #endif
 	    delete fPixmap;
 	    delete fDetachedPixmap;
+	    drop_scaled (0);
 	}
 
 
@@ -146,11 +170,21 @@ class Graphic: public UAS_Base {
 	    UAS_Pointer<Graphic> tmp(this);
 	    // fPixmap records the PixmapGraphic & pixmap once created (and only
 	    // if created via this method) for this instance of Graphic
-	    if (!fPixmap)
+	    if (!fPixmap) {
 		fPixmap = graphics_mgr().get_graphic (tmp);
+		graphics_mgr().decoded (this);
+	    }
 	    return fPixmap;
 	}
 
+	// The pixmap decoded at scale, kept with the graphic so that going
+	// back to a zoom factor does not decode it again. The graphic owns
+	// the result. 
+	PixmapGraphic *scaled_graphic (unsigned short scale);
+
+	// X server memory held by the decoded pixmaps, roughly 
+	unsigned long pixmap_bytes ();
+
 	// If this one is called instead of the null arg version, the resulting
 	// PixmapGraphic instance is not tracked nor recorded by this instance
 	PixmapGraphic *pixmap_graphic (UAS_String& imdata,
@@ -211,4 +245,15 @@ class Graphic: public UAS_Base {
 	UAS_Pointer<UAS_EmbeddedObject> fObj;
 
    	GraphicAgent 		       *fagent;
+
+	struct ScaledPixmap {
+	    unsigned short	fScale;
+	    PixmapGraphic      *fPixmap;
+	    ScaledPixmap       *fNext;
+	};
+
+	void drop_scaled (unsigned int keep);
+
+	ScaledPixmap		       *fScaled;	// most recent first 
+	GraphicEntry		       *fEntry;		// in the GraphicsMgr cache 
 };
@@ -42,8 +42,10 @@
  */
 
 #include "UAS.hh"
+#include <X11/Intrinsic.h>
 
 class NodeViewInfo;
+class NodeViewEntry;
 class NodeHandle;
 class NodeWindowAgent;
 class HitList ;
@@ -52,7 +54,8 @@ struct SelectionChanged : public Destructable
 {
 };
 
-class NodeMgr : public Long_Lived, public UAS_Sender<SelectionChanged>
+class NodeMgr : public Long_Lived, public UAS_Sender<SelectionChanged>,
+		public UAS_Receiver<UAS_LibraryDestroyedMsg>
 {
 public:  // functions
   NodeMgr();
@@ -81,6 +84,20 @@ public:  // functions
 
   NodeViewInfo *load(UAS_Pointer<UAS_Common> &node_ptr);
 
+  // How an agent gives back a view it got from load().  Unless keep is
+  // false the view is held for a later load() of the same node. 
+  void release (NodeViewInfo *, bool keep = TRUE);
+
+  // Drop the held views rendered for display_area, or all of them.
+  void flush_views (void *display_area = NULL);
+
+  void receive (UAS_LibraryDestroyedMsg &msg, void *client_data);
+
+  // Render the sections on either side of node_ptr while we are idle,
+  // so that paging through a book finds them in the view cache. 
+  void prefetch (UAS_Pointer<UAS_Common> &node_ptr, NodeWindowAgent *);
+  void cancel_prefetch();
+
   // How the Library mgr notifies us of other toplevel windows being visible
   void windows_notify (bool visible);
 
@@ -92,6 +109,10 @@ public:  // functions
 
 private:  // functions 
   NodeWindowAgent *create_agent();
+  void unlink_view (NodeViewEntry *);
+  void trim_views();
+  static Boolean prefetch_wp (XtPointer);
+  Boolean prefetch_next();
 
 private:  // variables 
   bool             f_force_new_window;
@@ -100,6 +121,22 @@ private:  // variables
   int		   f_font_scale ; // for old style.sheet 
   xList<NodeWindowAgent *> f_agent_list;
 
+  // rendered views, most recently used first 
+  NodeViewEntry   *f_views;
+  unsigned long    f_views_bytes;	// held (not displayed) views only 
+  unsigned long    f_views_limit;
+  bool             f_views_stats;
+  unsigned int     f_views_hits;
+  unsigned int     f_views_misses;
+
+  // background rendering of the neighbours of f_prefetch_node 
+  UAS_Pointer<UAS_Common> f_prefetch_node;
+  NodeWindowAgent *f_prefetch_agent;
+  XtWorkProcId     f_prefetch_id;
+  int              f_prefetch_step;
+  bool             f_prefetching;
+  unsigned int     f_views_prefetched;
+
   LONG_LIVED_HH(NodeMgr,node_mgr);
 };
 
@@ -70,6 +70,8 @@ public:
   static PrefSymbol NodeHistSize;
   static PrefSymbol SearchHistSize;
   static PrefSymbol MaxSearchHits;
+  static PrefSymbol NodeCacheSize;
+  static PrefSymbol GraphicsCacheSize;
   static PrefSymbol DefaultMarkBase;
   static PrefSymbol DisplayFirstHit;
   static PrefSymbol AutomaticHelp;
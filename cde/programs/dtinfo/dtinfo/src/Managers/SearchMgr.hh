@@ -48,6 +48,7 @@
 
 class QueryEditor;
 class ListView;
+class ResultID;
 
 class SearchMgr : public Long_Lived
 {
@@ -83,8 +84,12 @@ public: // functions
 
 private:
   friend class SeReconfigure;
+  friend class ShowPartialResults;
   void init();
 
+  void show_partial_results (UAS_Pointer<UAS_SearchResults> &results);
+  void discard_partial_results();
+
   void add_root   (UAS_Pointer<UAS_Common>& root);
   void remove_root(UAS_Pointer<UAS_Common>& root);
 
@@ -98,6 +103,7 @@ protected: // variables
   UAS_String	      f_search_section;
   UAS_Pointer<UAS_List<UAS_TextRun> > f_current_hits;
   UAS_List<UAS_Common> f_roots;
+  ResultID           *f_partial_results;
 
 private:
   LONG_LIVED_HH(SearchMgr,search_mgr);
@@ -55,10 +55,12 @@ public: //functions
   ~SearchResultsMgr();
 
   void display (ResultID *results);
+  void close (ResultID *results);
 
 protected: // functions
   SearchResultsAgent *get_agent ();
   static bool check_entry (ListEntry *, void *);
+  static bool check_results (ListEntry *, void *);
 
 protected: //variables
   LONG_LIVED_HH(SearchResultsMgr,search_results_mgr);
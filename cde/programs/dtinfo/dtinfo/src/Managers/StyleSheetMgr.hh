@@ -52,7 +52,11 @@ class FullStyleRecord ;
 
 #include "UAS.hh"
 
-class StyleSheetMgr : public Long_Lived
+// parsed style sheets kept for switching between bookcases
+#define STYLE_SHEET_CACHE_SIZE	8
+
+class StyleSheetMgr : public Long_Lived,
+		      public UAS_Receiver<UAS_LibraryDestroyedMsg>
 {
 public:
   StyleSheetMgr();
@@ -62,11 +66,32 @@ public:
   void initOnlineStyleSheet (UAS_Pointer<UAS_Common>&);
   void initPrintStyleSheet (UAS_Pointer<UAS_Common>&);
 
+  // style sheet in use, 0 for the built in default
+  UAS_Pointer<UAS_StyleSheet> &current_style_sheet()
+    { return fLastSS; }
+
+  // forget the style sheets of a library that is going away
+  void receive (UAS_LibraryDestroyedMsg &msg, void *client_data);
+
+private:
+    void useStyleSheet (UAS_Pointer<UAS_StyleSheet>&, const UAS_String &lid);
+    StyleSheet *parseStyleSheet (UAS_Pointer<UAS_StyleSheet>&);
+
 private:
     UAS_Pointer<UAS_StyleSheet> fLastSS;
     StyleSheet *fCurrent;
     int fStyleSheetRead;
 
+    // fCurrent is one of these unless it is the built in default or
+    // its library has been destroyed
+    UAS_Pointer<UAS_StyleSheet> fCachedSS[STYLE_SHEET_CACHE_SIZE];
+    UAS_String fCachedLid[STYLE_SHEET_CACHE_SIZE];
+    StyleSheet *fCached[STYLE_SHEET_CACHE_SIZE];
+    unsigned long fCachedUse[STYLE_SHEET_CACHE_SIZE];
+    unsigned long fUses;
+    unsigned int fParses;
+    int fStats;
+
 private:
   LONG_LIVED_HH(StyleSheetMgr,style_sheet_mgr);
 };
@@ -32,6 +32,8 @@ class UAS_Base: public Destructable {
 	UAS_Base ();
 	virtual ~UAS_Base ();
 	int operator == (const UAS_Base &);
+	// number of UAS_Pointers to this object
+	unsigned int references () const { return fReferenceCount; }
 #if (defined(sparc) && defined(SC3)) || defined(__linux__)
 	/* SC++ 4.0.1 does not like these being protected  */
 #else
@@ -136,6 +136,9 @@ class UAS_Common: public UAS_Base,
 	virtual UAS_List<UAS_StyleSheet> style_sheet_list ();
 	virtual UAS_Pointer<UAS_Common> parent ();
 	virtual UAS_List<UAS_Common> children ();
+	//  Cheaper than children().length() when the kids themselves
+	//  are not needed.
+	virtual int has_children ();
 	virtual UAS_Pointer<UAS_Common> next ();
 	virtual UAS_Pointer<UAS_Common> previous ();
 
@@ -27,6 +27,7 @@
 template <class T> class UAS_Pointer;
 class UAS_Common;
 class UAS_Collection;
+class UAS_SearchResults;
 
 class UAS_StatusMsg {
     public:
@@ -82,4 +83,13 @@ class UAS_SearchMsg {
         unsigned char  fContFlag;
 };
 
+// sent while a search over several bookcases is still running, each
+// time the results of another bookcase have been merged into fResults
+class UAS_SearchResultsMsg {
+    public:
+        UAS_Pointer<UAS_SearchResults> fResults;
+        int            fNumBcases;
+        int            fMaxNumBcases;
+};
+
 # endif
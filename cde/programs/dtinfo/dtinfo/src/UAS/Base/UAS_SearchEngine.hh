@@ -47,6 +47,7 @@ class UAS_SearchEngine : public UAS_Base {
 		   unsigned int maxDocs = 2000);
 
     STATIC_SENDER_HH (UAS_SearchMsg);
+    STATIC_SENDER_HH (UAS_SearchResultsMsg);
 
     unsigned int avail_caps();
 
@@ -44,7 +44,7 @@ class UAS_SearchResultsEntry : public UAS_Base {
 
     UAS_Pointer<UAS_Common> document ();
 
-    UAS_String id() const		{ return f_id; }
+    virtual UAS_String id() const	{ return f_id; }
     UAS_String book() const		{ return f_book; }
     UAS_String section() const		{ return f_section; }
     unsigned int relevance () const	{ return f_relevance; }
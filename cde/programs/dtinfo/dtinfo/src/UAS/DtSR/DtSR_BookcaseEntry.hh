@@ -53,7 +53,8 @@ class DtSR_BookcaseSearchEntry : public DtSR_BookcaseEntry
 
   public:
     DtSR_BookcaseSearchEntry(int dbn, UAS_Pointer<UAS_Common>& bc,
-				      int searchable = 0);
+				      int searchable = 0,
+				      const char* path = NULL);
     virtual ~DtSR_BookcaseSearchEntry();
 
     short	language() { return f_language; }
@@ -65,6 +66,10 @@ class DtSR_BookcaseSearchEntry : public DtSR_BookcaseEntry
 
     UAS_Pointer<UAS_Common> bcase() { return uas_bcase; }
 
+    // id of the book a section belongs to, looked up in the book map
+    // dtinfogen leaves next to the index. empty if there is no map.
+    UAS_String book_id(const char* section);
+
 
 #if !defined(SC3) && !defined(__linux__)
 
@@ -77,6 +82,7 @@ class DtSR_BookcaseSearchEntry : public DtSR_BookcaseEntry
 
   private:
     void _search_zones(UAS_SearchZones& search_zones);
+    void load_book_map();
 
     UAS_Pointer<UAS_String>	f_dbname;
     int				f_dbn;
@@ -88,6 +94,12 @@ class DtSR_BookcaseSearchEntry : public DtSR_BookcaseEntry
 
     UAS_Pointer<DtSR_Stems> f_stems;
 
+    UAS_String			f_path;		// bookcase directory
+
+    char*			f_book_map;	// contents of <dbname>.bkm
+    char**			f_sections;	// sorted "section\0book" pairs
+    int				f_nsections;	// -1 until the map is read
+
     // list of bookcases to which this belongs
     static UAS_Pointer<UAS_List<DtSR_BookcaseSearchEntry> > f_bcases;
     static UAS_List<DtSR_BookcaseSearchEntry> &bcases();
@@ -58,6 +58,8 @@ class DtSR_SearchEngine : public UAS_SearchEngine
     DtSR_SearchEngine();
     void init(UAS_PtrList<const char> *bcases);
 
+    int db_index(UAS_BookcaseEntry *);
+
     // NOTE: compress_DtSrResult frees res space
     UAS_Pointer<UAS_List<UAS_SearchResultsEntry> >
 		compress_DtSrResult(DtSrResult*&, long &);
@@ -41,6 +41,12 @@ class DtSR_SearchResultsEntry : public UAS_SearchResultsEntry
 
     UAS_Pointer<UAS_List<UAS_TextRun> > matches() const;
 
+    // locator of the section, resolved the first time it is asked for
+    UAS_String id() const;
+
+    // section id as found in the abstract
+    UAS_String section_id() const { return f_section_id; }
+
     // calculates relevance based on f_proximity values
     unsigned int relevance();
 
@@ -77,6 +83,7 @@ class DtSR_SearchResultsEntry : public UAS_SearchResultsEntry
     virtual void	unreference();
 
   private:
+    UAS_String		f_section_id;
     int			f_dbn;		// database number
     short		f_language;	// language of the database
     unsigned int	f_zone;		// bitmask
@@ -7,6 +7,7 @@ MMDB_Common.C \
 MMDB_Factory.C \
 MMDB_Section.C \
 MMDB_Library.C \
+MMDB_Manifest.C \
 MMDB_BookCase.C \
 MMDB_EmbeddedObject.C \
 MMDB_StyleSheet.C
@@ -30,6 +30,8 @@
 # include "oliasdb/mmdb.h"
 # include "oliasdb/collectionIterator.h"
 
+class MMDB_Manifest;
+
 class MMDB
 {
 public:
@@ -38,6 +40,7 @@ public:
   OLIAS_DB *database();
   info_lib *infolib () { return f_infoLib; }
   info_base *infobase (const char *locator);
+  MMDB_Manifest &manifest () { return *f_manifest; }
   MMDB &mmdb()
     { return (*this); }
 
@@ -45,9 +48,10 @@ public:
   UAS_String infoLibUid ();
 
 private:
-  int          f_initialized;
+  int          f_bad_reported;
   OLIAS_DB	*f_oliasDB;
   info_lib	*f_infoLib;
+  MMDB_Manifest	*f_manifest;
   UAS_String	fInfoLibPath;
 };
 
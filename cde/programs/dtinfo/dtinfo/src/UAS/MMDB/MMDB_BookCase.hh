@@ -37,6 +37,7 @@ class MMDB_BookCase: public UAS_Common, public MMDB_Common {
     public:
 	UAS_Pointer<UAS_Common> parent ();
 	UAS_List<UAS_Common> children ();
+	int has_children ();
 	UAS_String title (UAS_TitleType tt = UAS_LONG_TITLE);
 	UAS_String locator ();
 	UAS_String id ();
@@ -48,6 +49,9 @@ class MMDB_BookCase: public UAS_Common, public MMDB_Common {
 	UAS_String implementation_type() {
 	    return UAS_String ("mmdb", -1, UAS_NOT_OWNER);
 	}
+
+    private:
+	int num_of_docs ();
 };
 
 # endif
@@ -0,0 +1,71 @@
+/*
+ * CDE - Common Desktop Environment
+ *
+ * Copyright (c) 1993-2012, The Open Group. All rights reserved.
+ *
+ * These libraries and programs are free software; you can
+ * redistribute them and/or modify them under the terms of the GNU
+ * Lesser General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option)
+ * any later version.
+ *
+ * These libraries and programs are distributed in the hope that
+ * they will be useful, but WITHOUT ANY WARRANTY; without even the
+ * implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE. See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with these libraries and programs; if not, write
+ * to the Free Software Foundation, Inc., 51 Franklin Street, Fifth
+ * Floor, Boston, MA 02110-1301 USA
+ */
+# ifndef _MMDB_Manifest_hh_
+# define _MMDB_Manifest_hh_
+
+# include "UAS_String.hh"
+# include "UAS_PtrList.hh"
+
+class MMDB;
+class info_base;
+
+//  A startup manifest for an infolib: what dtinfo needs to know
+//  about each of its bookcases to populate the library window,
+//  recorded by an earlier run so the bookcase's stores need not be
+//  opened for it. The names, titles and locators of the bookcases
+//  come from the infolib's map file, which is read in any case, so
+//  only what needs a store (the number of books) is kept here.
+//
+//  The manifest lives in $DTINFO_MANIFEST_DIR/<infolib uid>.manifest
+//  and is not used when DTINFO_MANIFEST_DIR is unset. A bookcase's
+//  record is trusted only while the modification times of the map
+//  file and of the bookcase's data file are those recorded with it.
+
+class MMDB_ManifestEntry;
+
+class MMDB_Manifest {
+    public:
+	MMDB_Manifest (MMDB &);
+	~MMDB_Manifest ();
+
+    public:
+	//  Number of books in a bookcase, or -1 if the manifest has
+	//  no up to date record of it.
+	int num_of_docs (info_base *);
+
+	//  Record the number of books in a bookcase and rewrite the
+	//  manifest if it changed.
+	void set_num_of_docs (info_base *, int);
+
+    private:
+	void load ();
+	void save ();
+	MMDB_ManifestEntry *entry (info_base *);
+
+    private:
+	UAS_String			fPath;
+	long				fMapTime;
+	UAS_PtrList<MMDB_ManifestEntry>	fEntries;
+};
+
+# endif
@@ -62,6 +62,7 @@ class MMDB_Section: public UAS_Common, public MMDB_Common {
 	UAS_Pointer<UAS_Common> previous ();
 	UAS_Pointer<UAS_Common> parent ();
 	UAS_List<UAS_Common> children ();
+	int has_children ();
 	UAS_String implementation_type() {
 	    return UAS_String ("mmdb", -1, UAS_NOT_OWNER);
 	}
@@ -72,6 +73,7 @@ class MMDB_Section: public UAS_Common, public MMDB_Common {
     protected:
 	node_smart_ptr fNode;
 	UAS_String fTabTitle;
+	int fTabTitleValid;
 
 	UAS_String f_precise_id;
 	UAS_String f_label;
@@ -28,10 +28,15 @@
  *		fill_data1
  *		load_into_bintree
  *		main
+ *		merge_runs
+ *		pass1_job
  *		print_exit_code
  *		print_usage_msg
+ *		parallel_pass1
  *		put_addrs_2_dtbs_addr_file
+ *		read_run_word
  *		segregate_dicname
+ *		store_word_addr
  *		traverse_tree
  *		user_args_processor
  *		write_2_dtbs_addr_file
@@ -66,6 +71,12 @@
  * individual words by the parser function for the database's language.
  * Each record ends with a delimiter string specified by command line arg.
  *
+ * With -j<N>, Pass 1 reads the record keys itself but leaves the
+ * parsing to N child processes, each taking an Nth of the records,
+ * in file order, into its own binary tree.  Each child writes its tree out in order as a 'run'
+ * file, and Pass 2 merges the runs instead of traversing one tree.
+ * The result in the database is the same as without -j.
+ *
  * $Log$
  * Revision 2.8  1996/04/10  19:50:38  miker
  * Deleted dangerous and unnecessary -a option.
@@ -122,6 +133,7 @@
 #include <errno.h>
 #include <math.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <locale.h>
 #include "vista.h"
 
@@ -220,6 +232,13 @@ time_t          timestart =		0;
 time_t          totalstart =		0;
 static int      words_per_dot =		WORDS_PER_DOT;
 
+/* Pass 1 jobs (-j).  Indexes of both arrays start at #1. */
+static int	num_jobs =		1;
+static DB_ADDR	*rec_dbas =		NULL;	/* rec# -> dba, 0 = discarded */
+static long	*rec_offsets =		NULL;	/* rec# -> input file offset */
+static DtSrINT32
+		*dba_recnos =		NULL;	/* dba -> rec# */
+
 /************************************************/
 /*						*/
 /*		     DBALIST			*/
@@ -307,6 +326,43 @@ static void     print_exit_code (int exit_code)
 }	/* print_exit_code() */
 
 
+/****************************************/
+/*					*/
+/*	     store_word_addr()		*/
+/*					*/
+/****************************************/
+/* Appends the weighted addr of one doc that contains the current
+ * word to 'record_addr_word[]'.  See write_to_file() below.
+ */
+static void	store_word_addr (DB_ADDR mydba, DtSrINT32 w_c)
+{
+    if (debugging & DEBUG_t)
+	printf ("    dba #%ld: node adr=%ld cnt=%ld",
+	    (long)num_addrs_for_word, (long)mydba, (long)w_c);
+
+    record_addr_word [num_addrs_for_word] =
+	mydba << 8;  /* rec# in hi 3 bytes */
+    record_addr_word [num_addrs_for_word] +=
+	(log ((double) (w_c) + 0.5) /
+	log ((double) (dbas_word_count[mydba] + 1))) * 256;
+
+    if (debugging & DEBUG_t)
+	printf ("  -> x%lx (%ld:%ld)\n",
+	    (long)record_addr_word [num_addrs_for_word],
+	    (long)record_addr_word [num_addrs_for_word] >> 8,
+	    (long)record_addr_word [num_addrs_for_word] & 0xffL);
+
+    num_addrs_for_word++;
+    if (num_addrs_for_word >= batch_size) {
+	printf (CATGETS(dtsearch_catd, MS_cborodin, 280,
+	    "\n%s num_addrs_for_word (%ld) >= batchsz (%ld).\n"),
+	    PROGNAME"280", (long)num_addrs_for_word, (long)batch_size);
+	DtSearchExit (91);
+    }
+    return;
+} /* store_word_addr() */
+
+
 /****************************************/
 /*					*/
 /*	     write_to_file()		*/
@@ -344,7 +400,6 @@ static void     print_exit_code (int exit_code)
 void            write_to_file (TREENODE * output_node)
 {
     DBALIST	*print_dba;
-    DB_ADDR	mydba;
 
     /* 'record_addr_word[]' was permanently allocated
      * with a size = max batch size so it can hold
@@ -364,32 +419,8 @@ void            write_to_file (TREENODE * output_node)
     num_addrs_for_word = 0;	/* DtSrINT32 */
     print_dba = output_node->dba_list;
     while (print_dba != NULL) {
-
-	mydba = print_dba->dba;
-	if (debugging & DEBUG_t)
-	    printf ("    dba #%ld: node adr=%ld cnt=%ld",
-		(long)num_addrs_for_word, (long)mydba, (long)print_dba->w_c);
-
-	record_addr_word [num_addrs_for_word] =
-	    mydba << 8;  /* rec# in hi 3 bytes */
-	record_addr_word [num_addrs_for_word] +=
-	    (log ((double) (print_dba->w_c) + 0.5) /
-	    log ((double) (dbas_word_count[mydba] + 1))) * 256;
-
-	if (debugging & DEBUG_t)
-	    printf ("  -> x%lx (%ld:%ld)\n",
-		(long)record_addr_word [num_addrs_for_word],
-		(long)record_addr_word [num_addrs_for_word] >> 8,
-		(long)record_addr_word [num_addrs_for_word] & 0xffL);
-
+	store_word_addr (print_dba->dba, print_dba->w_c);
 	print_dba = print_dba->next_dba;
-	num_addrs_for_word++;
-	if (num_addrs_for_word >= batch_size) {
-	    printf (CATGETS(dtsearch_catd, MS_cborodin, 280,
-		"\n%s num_addrs_for_word (%ld) >= batchsz (%ld).\n"),
-		PROGNAME"280", (long)num_addrs_for_word, (long)batch_size);
-	    DtSearchExit (91);
-	}
     }
     if ((debugging & DEBUG_T)  && !(debugging & DEBUG_t))
 	printf (" dbacnt=%ld\n", (long)num_addrs_for_word);
@@ -540,6 +571,7 @@ static void     print_usage_msg (void)
 "  -i<N>       Change (i)nput buffer size from default %d to <N>.\n"
 "  -h<N>       Change duplicate record id hash table size from %ld to <N>.\n"
 "              -h0 means there are no duplicates, do not check for them.\n"
+"  -j<N>       Parse records with <N> processes in Pass 1.  Default 1.\n"
 "  <infile>    Input [path]file name.  Default extension %s.\n"),
 	aa_argv0,
 	(int) RECS_PER_DOT,
@@ -715,6 +747,15 @@ CACHE_ADJUSTED:
 		}
 		break;
 
+	    case 'j':		/* Pass 1 jobs */
+		if ((num_jobs = atoi (argptr + 2)) <= 0) {
+		    printf (CATGETS(dtsearch_catd, MS_cborodin, 574,
+			"%s Invalid arg '%s'.  Using default -j%d.\n"),
+			PROGNAME"574", argptr, 1);
+		    num_jobs = 1;
+		}
+		break;
+
 	    case 'i':		/* (I)nput buffer size */
 		if ((inbufsz = atol (argptr + 2)) <= 0) {
 		    printf (CATGETS(dtsearch_catd, MS_cborodin, 558,
@@ -1356,6 +1397,308 @@ static void	load_into_bintree (
 } /* load_into_bintree() */
 
 
+/************************************************/
+/*						*/
+/*		    pass1_job			*/
+/*						*/
+/************************************************/
+/* Pass 1 child process number 'job' of -j.
+ * Rereads its share of the input file, parses the records
+ * that the parent kept into its own binary tree, and writes
+ * the tree to a run file:
+ *   1. (dba, word count) pairs for its records, ended by dba 0.
+ *   2. For each word in order: the word with its \0, the number
+ *      of addrs, and that many (dba, count) pairs in the same
+ *      order as the tree's dba list.
+ * All numbers are DtSrINT32 in host order.  Never returns.
+ */
+static void	pass1_job (int job, char *runfile)
+{
+    FILE		*runfp;
+    char		*cptr;
+    unsigned long	recno, lastrec;
+    DB_ADDR		dba;
+    DtSrINT32		int32;
+    DBALIST		*dbal;
+    TREENODE		*node;
+    TREENODE		**nodestack = NULL;
+    size_t		stacksz = 0, depth = 0;
+    int			i;
+
+    /* Leave the parent's database alone if we die */
+    austext_exit_dbms = NULL;
+    austext_exit_last = NULL;
+
+    recno = record_count * job / num_jobs;
+    lastrec = record_count * (job + 1) / num_jobs;
+
+    if ((instream = fopen (fname_input, "rt")) == NULL)
+	_exit (14);
+    if (recno < lastrec  &&
+	    fseek (instream, rec_offsets [recno + 1], SEEK_SET) != 0)
+	_exit (14);
+    parg.ftext = instream;
+
+    while (recno < lastrec  &&  fgets (inbuf, inbufsz, instream) != NULL) {
+	inbuf [inbufsz] = 0;
+	if (strcmp (inbuf, parg.etxdelim) == 0)
+	    continue;
+	recno++;
+
+	if ((dba = rec_dbas [recno]) == 0) {
+	    discard_to_ETX (&parg);
+	    continue;
+	}
+
+	/* Lines 2 - 4 were checked by the parent */
+	for (i = 0;  i < 3;  i++)
+	    if (fgets (inbuf, inbufsz, instream) == NULL)
+		_exit (22);
+	inbuf [inbufsz] = 0;
+
+	for (	cptr = dblk.parser (&parg);
+		cptr;
+		cptr = dblk.parser (NULL)) {
+	    load_into_bintree (cptr, FALSE, dba);
+	    cptr = dblk.stemmer (cptr, &dblk);
+	    load_into_bintree (cptr, TRUE, dba);
+	}
+    }
+
+    if ((runfp = fopen (runfile, "wb")) == NULL)
+	_exit (13);
+
+    for (dba = 1;  dba <= or_maxdba;  dba++) {
+	if (dbas_word_count[dba] == 0)
+	    continue;
+	fwrite (&dba, sizeof(DB_ADDR), 1, runfp);
+	fwrite (&dbas_word_count[dba], sizeof(DtSrINT32), 1, runfp);
+    }
+    dba = 0;
+    fwrite (&dba, sizeof(DB_ADDR), 1, runfp);
+
+    /* In order traversal of the tree */
+    node = root_node;
+    while (node != NULL  ||  depth > 0) {
+	if (node != NULL) {
+	    if (depth >= stacksz) {
+		stacksz = (stacksz)? stacksz * 2 : 1024;
+		nodestack = realloc (nodestack, stacksz * sizeof(TREENODE *));
+		if (nodestack == NULL)
+		    _exit (26);
+	    }
+	    nodestack [depth++] = node;
+	    node = node->llink;
+	    continue;
+	}
+	node = nodestack [--depth];
+
+	fwrite (node->word, strlen (node->word) + 1, 1, runfp);
+	for (int32 = 0, dbal = node->dba_list;  dbal;  dbal = dbal->next_dba)
+	    int32++;
+	fwrite (&int32, sizeof(DtSrINT32), 1, runfp);
+	for (dbal = node->dba_list;  dbal;  dbal = dbal->next_dba) {
+	    fwrite (&dbal->dba, sizeof(DB_ADDR), 1, runfp);
+	    fwrite (&dbal->w_c, sizeof(DtSrINT32), 1, runfp);
+	}
+
+	node = node->rlink;
+    }
+
+    if (fclose (runfp) != 0)
+	_exit (96);
+    _exit (0);
+} /* pass1_job() */
+
+
+/************************************************/
+/*						*/
+/*		  parallel_pass1		*/
+/*						*/
+/************************************************/
+/* Runs the -j Pass 1 jobs once the parent has read all the
+ * record keys, and waits for them.  Returns FALSE if a job failed.
+ */
+static int	parallel_pass1 (char **runfiles)
+{
+    int		job;
+    int		status;
+    int		ok = TRUE;
+    pid_t	pid;
+
+    printf (CATGETS(dtsearch_catd, MS_cborodin, 1250,
+	"%s: Parsing records with %d jobs.\n"),
+	aa_argv0, num_jobs);
+    fflush (stdout);
+    fflush (aa_stderr);
+
+    for (job = 0;  job < num_jobs;  job++) {
+	if ((pid = fork ()) < 0) {
+	    ok = FALSE;
+	    break;
+	}
+	if (pid == 0)
+	    pass1_job (job, runfiles[job]);
+    }
+
+    for (;;) {
+	if ((pid = wait (&status)) < 0) {
+	    if (errno == EINTR)
+		continue;
+	    break;
+	}
+	if (!WIFEXITED (status)  ||  WEXITSTATUS (status) != 0)
+	    ok = FALSE;
+    }
+    return ok;
+} /* parallel_pass1() */
+
+
+/************************************************/
+/*						*/
+/*		  read_run_word			*/
+/*						*/
+/************************************************/
+/* Reads the next word of a -j run file and its addr count.
+ * Returns FALSE at end of file.
+ */
+static int	read_run_word (FILE *runfp, char *word, DtSrINT32 *count)
+{
+    int		c;
+    int		len = 0;
+
+    while ((c = getc (runfp)) != EOF  &&  c != 0)
+	if (len < DtSrMAXWIDTH_HWORD + 2)
+	    word [len++] = c;
+    word [len] = 0;
+    if (c == EOF)
+	return FALSE;
+    return (fread (count, sizeof(DtSrINT32), 1, runfp) == 1);
+} /* read_run_word() */
+
+
+/************************************************/
+/*						*/
+/*		    merge_runs			*/
+/*						*/
+/************************************************/
+/* Merges the -j run files in word order.  With update FALSE it
+ * only adds up the jobs' word counts into dbas_word_count[]
+ * and counts the different words.  With update TRUE it is
+ * Pass 2: each word's addrs from all runs are put back in the
+ * order a single tree would have had, by descending record
+ * number, and written to the database by fill_data1().
+ */
+static void	merge_runs (char **runfiles, int update)
+{
+    typedef struct {
+	FILE		*fp;
+	int		live;
+	DtSrINT32	count;
+	char		word [DtSrMAXWIDTH_HWORD + 4];
+    } RUN;
+
+    RUN		*runs;
+    RUN		*minrun;
+    DB_ADDR	dba;
+    DtSrINT32	int32, wc;
+    DtSrINT32	*pos;		/* next addr to take from each run */
+    DtSrINT32	*cnt;
+    DB_ADDR	(*addrs)[2];	/* each run's addrs for the word */
+    int		job, best;
+    char	curword [DtSrMAXWIDTH_HWORD + 4];
+
+    runs = austext_malloc (num_jobs * sizeof(RUN), PROGNAME"1701", NULL);
+    pos = austext_malloc (num_jobs * sizeof(DtSrINT32), PROGNAME"1702", NULL);
+    cnt = austext_malloc (num_jobs * sizeof(DtSrINT32), PROGNAME"1703", NULL);
+    addrs = austext_malloc (
+	((size_t)batch_size + 1) * sizeof(*addrs),
+	PROGNAME"1704", NULL);
+
+    for (job = 0;  job < num_jobs;  job++) {
+	if ((runs[job].fp = fopen (runfiles[job], "rb")) == NULL) {
+	    printf (CATGETS(dtsearch_catd, MS_cborodin, 1254,
+		"%s Can't read temporary file '%s': %s\n"),
+		PROGNAME"1254", runfiles[job], strerror(errno));
+	    DtSearchExit (13);
+	}
+	while (fread (&dba, sizeof(DB_ADDR), 1, runs[job].fp) == 1  &&
+		dba != 0) {
+	    fread (&wc, sizeof(DtSrINT32), 1, runs[job].fp);
+	    if (!update  &&  dba <= or_maxdba)
+		dbas_word_count[dba] += wc;
+	}
+	runs[job].live = read_run_word (runs[job].fp,
+	    runs[job].word, &runs[job].count);
+    }
+
+    for (;;) {
+	minrun = NULL;
+	for (job = 0;  job < num_jobs;  job++)
+	    if (runs[job].live  &&  (minrun == NULL  ||
+		    strcmp (runs[job].word, minrun->word) < 0))
+		minrun = &runs[job];
+	if (minrun == NULL)
+	    break;
+	strcpy (curword, minrun->word);
+	if (!update)
+	    num_of_diff_words++;
+
+	/* Take the addrs of every run that has this word */
+	int32 = 0;
+	for (job = 0;  job < num_jobs;  job++) {
+	    cnt[job] = 0;
+	    pos[job] = int32;
+	    if (!runs[job].live  ||  strcmp (runs[job].word, curword) != 0)
+		continue;
+	    if (update) {
+		if (fread (addrs [int32], sizeof(DB_ADDR) * 2,
+			(size_t)runs[job].count, runs[job].fp) !=
+			(size_t)runs[job].count) {
+		    printf (CATGETS(dtsearch_catd, MS_cborodin, 1254,
+			"%s Can't read temporary file '%s': %s\n"),
+			PROGNAME"1254", runfiles[job], strerror(errno));
+		    DtSearchExit (13);
+		}
+		cnt[job] = runs[job].count;
+		int32 += runs[job].count;
+	    }
+	    else
+		fseek (runs[job].fp,
+		    (long)runs[job].count * 2 * sizeof(DB_ADDR), SEEK_CUR);
+	    runs[job].live = read_run_word (runs[job].fp,
+		runs[job].word, &runs[job].count);
+	}
+	if (!update)
+	    continue;
+
+	num_addrs_for_word = 0;
+	for (;;) {
+	    best = -1;
+	    for (job = 0;  job < num_jobs;  job++)
+		if (cnt[job] > 0  &&  (best < 0  ||
+			dba_recnos [addrs [pos[job]][0]] >
+			dba_recnos [addrs [pos[best]][0]]))
+		    best = job;
+	    if (best < 0)
+		break;
+	    store_word_addr (addrs [pos[best]][0], addrs [pos[best]][1]);
+	    pos[best]++;
+	    cnt[best]--;
+	}
+	fill_data1 (curword);
+    }
+
+    for (job = 0;  job < num_jobs;  job++)
+	fclose (runs[job].fp);
+    free (addrs);
+    free (cnt);
+    free (pos);
+    free (runs);
+    return;
+} /* merge_runs() */
+
+
 /**********************************************/
 /*                                            */
 /*                    MAIN                    */
@@ -1367,6 +1710,7 @@ main (int argc, char **argv)
     int			i;
     long		word_offset;	/* <-- PARG.offsetp */
     long		bytes_in;	/* ftell() */
+    long		rec_start = 0L;	/* ftell() at line #1 */
     DtSrINT32		dba_offset;
     int			got_ETX;
     char		*cptr, *src;
@@ -1379,6 +1723,7 @@ main (int argc, char **argv)
     time_t		elapsed;
     size_t		mallocsz;
     char		*parsebufp, *stembufp;
+    char		**runfiles = NULL;
 
     /******************* INITIALIZE ******************/
     setlocale (LC_ALL, "");
@@ -1472,6 +1817,23 @@ main (int argc, char **argv)
     memset (dbas_bits_batch, 0, (size_t)bit_vector_size + 48);
     memset (dbas_word_count, 0, mallocsz);
 
+    /* With -j, Pass 1 saves the dba and file offset of each record
+     * for the jobs, and the record number of each dba for merging
+     * their runs.
+     */
+    if (num_jobs > 1) {
+	rec_dbas = (DB_ADDR *) austext_malloc (
+	    sizeof(DB_ADDR) * (batch_size + 1) + 48,
+	    PROGNAME "1156", NULL);
+	rec_offsets = (long *) austext_malloc (
+	    sizeof(long) * (batch_size + 1) + 48,
+	    PROGNAME "1157", NULL);
+	dba_recnos = (DtSrINT32 *) austext_malloc (mallocsz,
+	    PROGNAME "1158", NULL);
+	memset (rec_dbas, 0, sizeof(DB_ADDR) * (batch_size + 1) + 48);
+	memset (dba_recnos, 0, mallocsz);
+    }
+
     root_node = NULL;
 
    /* Open the d99 file that contains database addresses.
@@ -1558,6 +1920,8 @@ BAD_INPUT_FILE:
 	 */
 
 	/*----- READ LINE #1, fzkey -----*/
+	if (rec_offsets)
+	    rec_start = ftell (instream);
         if (fgets (inbuf, inbufsz, instream) == NULL)
 	    break;
 	inbuf [inbufsz] = 0;	/* just to be sure */
@@ -1575,6 +1939,8 @@ BAD_INPUT_FILE:
 	    continue;
 
 	record_count++;
+	if (rec_offsets  &&  record_count <= batch_size)
+	    rec_offsets [record_count] = rec_start;
 
 	/*----- READ LINE #2, abstract -----*/
 	if (fgets (inbuf, inbufsz, instream) == NULL) {
@@ -1707,6 +2073,16 @@ INVALID_FZK_FORMAT:
 	    goto INVALID_FZK_FORMAT;
 	inbuf[inbufsz] = 0;	/* just to be sure */
 
+	/* With -j the jobs parse the text, see parallel_pass1() */
+	if (num_jobs > 1) {
+	    if (record_count <= batch_size) {
+		rec_dbas [record_count] = dba;
+		dba_recnos [dba] = record_count;
+	    }
+	    discard_to_ETX (&parg);
+	    continue;
+	}
+
 	/* PARSE LOOP FOR CURRENT TEXT BLOCK.
 	 * We must be in the middle of a record ('lines' #5 and beyond).
 	 * From here to ETX, which is either the record delimiter string
@@ -1744,6 +2120,28 @@ INVALID_FZK_FORMAT:
 
     } /* end of PASS 1 Main read loop */
 
+    /* Parse the records with the -j jobs, and count
+     * their words.  Too many records will abort below.
+     */
+    if (num_jobs > 1  &&  record_count <= batch_size) {
+	runfiles = austext_malloc (num_jobs * sizeof(char *),
+	    PROGNAME"1231", NULL);
+	for (i = 0;  i < num_jobs;  i++) {
+	    runfiles[i] = austext_malloc (strlen (dtbs_addr_file) + 16,
+		PROGNAME"1232", NULL);
+	    sprintf (runfiles[i], "%s.r%d", dtbs_addr_file, i);
+	}
+	if (!parallel_pass1 (runfiles)) {
+	    printf (CATGETS(dtsearch_catd, MS_cborodin, 1252,
+		"%s Abort. A Pass 1 job failed.\n"),
+		PROGNAME"1252");
+	    for (i = 0;  i < num_jobs;  i++)
+		unlink (runfiles[i]);
+	    DtSearchExit (35);
+	}
+	merge_runs (runfiles, FALSE);
+    }
+
     elapsed = time(NULL) - timestart;
     if (dotcount > 0) {
 	putchar ('\n');
@@ -1783,7 +2181,19 @@ INVALID_FZK_FORMAT:
 	aa_argv0, words_per_dot);
     dotcount = 0;
     time (&timestart);
-    traverse_tree (); 	/* actual Pass 2 */
+    if (runfiles) {
+	if (num_of_diff_words == 0) {
+	    printf (CATGETS(dtsearch_catd, MS_cborodin, 288,
+		"%s Abort. There are no words in the input file %s.\n"),
+		PROGNAME"288", fname_input);
+	    DtSearchExit (34);
+	}
+	merge_runs (runfiles, TRUE);
+	for (i = 0;  i < num_jobs;  i++)
+	    unlink (runfiles[i]);
+    }
+    else
+	traverse_tree (); 	/* actual Pass 2 */
     if (dotcount) {
 	putchar ('\n');
 	dotcount = 0;
@@ -1802,6 +2212,11 @@ INVALID_FZK_FORMAT:
     printf (CATGETS(dtsearch_catd, MS_cborodin, 1246,
 	"%s: Pass 2 completed in %lum %lus, updated %lu words.\n"),
 	aa_argv0, elapsed / 60L, elapsed % 60L, count_word_ii);
+    elapsed = time (NULL) - totalstart;
+    printf (CATGETS(dtsearch_catd, MS_cborodin, 1256,
+	"%s: Indexed %lu records in %lds, %.1f records per second.\n"),
+	aa_argv0, record_count, (long)elapsed,
+	(elapsed > 0)? (double)record_count / elapsed : (double)record_count);
     if (normal_retncode == 1)
 	printf (CATGETS(dtsearch_catd, MS_cborodin, 2,
 	    "%s: Warnings were detected.\n"), aa_argv0);